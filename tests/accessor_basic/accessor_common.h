@@ -85,19 +85,22 @@ namespace accessor_tests_common {
  * @param access_mode_name String with name of the testing access mode
  * @param target_name String with name of the testing target
  * @param section_description String with human-readable description of the test
- * @return std::string String with name for section
+ * @return const std::string& Interned string with name for section
  */
 template <int Dimension>
-inline std::string get_section_name(const std::string& type_name,
-                                    const std::string& access_mode_name,
-                                    const std::string& target_name,
-                                    const std::string& section_description) {
-  return section_name(section_description)
-      .with("T", type_name)
-      .with("access mode", access_mode_name)
-      .with("target", target_name)
-      .with("dimension", Dimension)
-      .create();
+inline const std::string& get_section_name(
+    const std::string& type_name, const std::string& access_mode_name,
+    const std::string& target_name, const std::string& section_description) {
+  return intern_section_name(
+      [&] {
+        return section_name(section_description)
+            .with("T", type_name)
+            .with("access mode", access_mode_name)
+            .with("target", target_name)
+            .with("dimension", Dimension)
+            .create();
+      },
+      type_name, access_mode_name, target_name, section_description);
 }
 
 /**
@@ -109,17 +112,21 @@ inline std::string get_section_name(const std::string& type_name,
  * @param access_mode_name String with name of the testing access mode
  * @param target_name String with name of the testing target
  * @param section_description String with human-readable description of the test
- * @return std::string String with name for section
+ * @return const std::string& Interned string with name for section
  */
 template <int Dimension>
-inline std::string get_section_name(const std::string& type_name,
-                                    const std::string& access_mode_name,
-                                    const std::string& section_description) {
-  return section_name(section_description)
-      .with("T", type_name)
-      .with("access mode", access_mode_name)
-      .with("dimension", Dimension)
-      .create();
+inline const std::string& get_section_name(
+    const std::string& type_name, const std::string& access_mode_name,
+    const std::string& section_description) {
+  return intern_section_name(
+      [&] {
+        return section_name(section_description)
+            .with("T", type_name)
+            .with("access mode", access_mode_name)
+            .with("dimension", Dimension)
+            .create();
+      },
+      type_name, access_mode_name, section_description);
 }
 
 /**
@@ -129,15 +136,19 @@ inline std::string get_section_name(const std::string& type_name,
  * @tparam Dimension Integer representing dimension
  * @param type_name String with name of the testing type
  * @param section_description String with human-readable description of the test
- * @return std::string String with name for section
+ * @return const std::string& Interned string with name for section
  */
 template <int Dimension>
-inline std::string get_section_name(const std::string& type_name,
-                                    const std::string& section_description) {
-  return section_name(section_description)
-      .with("T", type_name)
-      .with("dimension", Dimension)
-      .create();
+inline const std::string& get_section_name(
+    const std::string& type_name, const std::string& section_description) {
+  return intern_section_name(
+      [&] {
+        return section_name(section_description)
+            .with("T", type_name)
+            .with("dimension", Dimension)
+            .create();
+      },
+      type_name, section_description);
 }
 
 // FIXME: re-enable when marrray is implemented in adaptivecpp and type_coverage
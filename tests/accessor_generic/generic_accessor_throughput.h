@@ -0,0 +1,263 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Common code for sycl::accessor throughput measurements in device kernels
+//
+*******************************************************************************/
+
+#ifndef SYCL_CTS_GENERIC_ACCESSOR_THROUGHPUT_H
+#define SYCL_CTS_GENERIC_ACCESSOR_THROUGHPUT_H
+
+#include "../accessor_basic/accessor_common.h"
+#include "../common/common.h"
+#include "../common/failure_recorder.h"
+#include "../common/performance.h"
+
+#include <functional>
+#include <memory>
+
+namespace generic_accessor_throughput {
+using namespace sycl_cts;
+using namespace accessor_tests_common;
+
+constexpr size_t preferred_buffer_bytes = 64 * 1024 * 1024;
+constexpr size_t row_size = 64;
+
+enum class variant { accessor, accessor_no_init, usm };
+
+template <typename T, sycl::access_mode AccessMode, int Dims, variant Variant>
+class kernel_throughput;
+
+/**
+ * @brief Returns the range with \p count elements, using rows of row_size
+ *        elements for every dimension except the first one
+ */
+template <int Dims>
+sycl::range<Dims> make_range(size_t count) {
+  if constexpr (Dims == 1) {
+    return sycl::range<1>(count);
+  } else if constexpr (Dims == 2) {
+    return sycl::range<2>(count / row_size, row_size);
+  } else {
+    return sycl::range<3>(count / (row_size * row_size), row_size, row_size);
+  }
+}
+
+/**
+ * @brief Value each element holds before the kernel runs
+ */
+template <typename T>
+T initial_value() {
+  return T(1);
+}
+
+/**
+ * @brief Value each element holds after the kernel ran at least once
+ * @details Kernels with access_mode::read do not modify the data. Kernels with
+ *          access_mode::write store updated_value() unconditionally, while
+ *          kernels with access_mode::read_write only replace initial_value(),
+ *          so the data is the same no matter how many times they run.
+ */
+template <typename T, sycl::access_mode AccessMode>
+T expected_value() {
+  return AccessMode == sycl::access_mode::read ? initial_value<T>() : T(0);
+}
+
+/**
+ * @brief Per-element operation shared by the accessor and USM kernels
+ * @param mismatch Set if the read value differs from initial_value()
+ */
+template <typename T, sycl::access_mode AccessMode, typename RefT>
+void process_element(RefT&& element, int& mismatch) {
+  if constexpr (AccessMode == sycl::access_mode::read) {
+    if (element != initial_value<T>()) mismatch = 1;
+  } else if constexpr (AccessMode == sycl::access_mode::write) {
+    element = expected_value<T, AccessMode>();
+  } else {
+    if (element == initial_value<T>())
+      element = expected_value<T, AccessMode>();
+  }
+}
+
+template <typename T, typename AccessModeT, typename DimensionT>
+class run_throughput {
+  static constexpr sycl::access_mode AccessMode = AccessModeT::value;
+  static constexpr int Dims = DimensionT::value;
+
+  template <variant Variant>
+  using kernel_name = kernel_throughput<T, AccessMode, Dims, Variant>;
+
+ public:
+  void operator()(const std::string& type_name,
+                  const std::string& access_mode_name) {
+    auto queue = once_per_unit::get_queue();
+    const auto device = queue.get_device();
+
+    const size_t granularity = row_size * row_size;
+    const size_t count =
+        std::max(performance::limit_alloc_size(device, preferred_buffer_bytes) /
+                     sizeof(T) / granularity,
+                 size_t{1}) *
+        granularity;
+    const size_t bytes = count * sizeof(T);
+    const auto range = make_range<Dims>(count);
+    const std::string name = type_name + ", " + access_mode_name + ", " +
+                             std::to_string(Dims) + "D";
+
+    std::unique_ptr<T[]> host_data(new T[count]);
+    // Buffer rather than USM, so no USM aspect is needed for the accessor
+    // measurements
+    sycl::buffer<int> mismatch{sycl::range<1>(1)};
+    auto reset_mismatch = [&] {
+      sycl::host_accessor(mismatch, sycl::write_only)[0] = 0;
+    };
+    reset_mismatch();
+
+    auto reset_host_data = [&] {
+      std::fill(host_data.get(), host_data.get() + count, initial_value<T>());
+    };
+
+    auto verify = [&](const T* data, const char* what) {
+      failure_recorder<T> failures;
+      for (size_t i = 0; i < count; ++i)
+        failures.check_equal(what, i, data[i], expected_value<T, AccessMode>());
+      CHECK(sycl::host_accessor(mismatch, sycl::read_only)[0] == 0);
+      failures.report(name);
+      reset_mismatch();
+    };
+
+    auto submit_accessor = [&](sycl::buffer<T, Dims>& buffer, auto tag) {
+      using tag_t = decltype(tag);
+      constexpr bool no_init = std::is_same_v<tag_t, std::true_type>;
+      constexpr variant Variant =
+          no_init ? variant::accessor_no_init : variant::accessor;
+      queue
+          .submit([&](sycl::handler& cgh) {
+            sycl::accessor mismatch_acc(mismatch, cgh, sycl::write_only);
+            auto acc = [&] {
+              if constexpr (no_init)
+                return sycl::accessor(buffer, cgh, sycl::write_only,
+                                      sycl::no_init);
+              else
+                return sycl::accessor<T, Dims, AccessMode>(buffer, cgh);
+            }();
+            cgh.parallel_for<kernel_name<Variant>>(
+                range, [=](sycl::item<Dims> item) {
+                  process_element<T, AccessMode>(acc[item.get_id()],
+                                                 mismatch_acc[0]);
+                });
+          })
+          .wait_and_throw();
+    };
+
+    auto run_accessor = [&](auto tag) {
+      constexpr bool no_init = decltype(tag)::value;
+      performance::result resident("accessor",
+                                   name + (no_init ? ", no_init" : ""));
+      performance::result end_to_end("accessor end-to-end",
+                                     name + (no_init ? ", no_init" : ""));
+
+      // Buffer constructed from host data and destroyed after every kernel,
+      // so data transfers required by the access mode are measured too; the
+      // host data is restored outside of the measurement
+      const auto t_end_to_end =
+          performance::measure_with_setup(reset_host_data, [&] {
+            sycl::buffer<T, Dims> buffer(host_data.get(), range);
+            submit_accessor(buffer, tag);
+          });
+      verify(host_data.get(), "end-to-end");
+      end_to_end.with("total", t_end_to_end)
+          .with("bandwidth",
+                performance::bandwidth_gbs(bytes, t_end_to_end), "GB/s")
+          .record();
+
+      // Buffer already resident on the device, so only the kernel accessing
+      // the data is measured
+      reset_host_data();
+      {
+        sycl::buffer<T, Dims> buffer(host_data.get(), range);
+        const auto t_kernel =
+            performance::measure([&] { submit_accessor(buffer, tag); });
+        resident.with("kernel", t_kernel)
+            .with("bandwidth", performance::bandwidth_gbs(bytes, t_kernel),
+                  "GB/s")
+            .record();
+      }
+      verify(host_data.get(), "resident");
+    };
+
+    auto run_usm = [&] {
+      std::unique_ptr<T, std::function<void(T*)>> device_data(
+          sycl::malloc_device<T>(count, queue),
+          [queue](T* ptr) { sycl::free(ptr, queue); });
+      REQUIRE(device_data != nullptr);
+
+      reset_host_data();
+      queue.copy(host_data.get(), device_data.get(), count).wait_and_throw();
+
+      T* ptr = device_data.get();
+      const auto t_kernel = performance::measure([&] {
+        queue
+            .submit([&](sycl::handler& cgh) {
+              sycl::accessor mismatch_acc(mismatch, cgh, sycl::write_only);
+              cgh.parallel_for<kernel_name<variant::usm>>(
+                  range, [=](sycl::item<Dims> item) {
+                    process_element<T, AccessMode>(ptr[item.get_linear_id()],
+                                                   mismatch_acc[0]);
+                  });
+            })
+            .wait_and_throw();
+      });
+      performance::result("usm", name)
+          .with("kernel", t_kernel)
+          .with("bandwidth", performance::bandwidth_gbs(bytes, t_kernel),
+                "GB/s")
+          .record();
+
+      queue.copy(device_data.get(), host_data.get(), count).wait_and_throw();
+      verify(host_data.get(), "usm");
+    };
+
+    SECTION(name) {
+      run_accessor(std::false_type{});
+      if constexpr (AccessMode == sycl::access_mode::write)
+        run_accessor(std::true_type{});
+      if (device.has(sycl::aspect::usm_device_allocations))
+        run_usm();
+      else
+        WARN("Device does not support USM device allocations, skipped the "
+             "USM comparison for "
+             << name);
+    }
+  }
+};
+
+/**
+ * @brief Runs the throughput measurements for every access mode and
+ *        dimension with each type of \p types
+ */
+template <typename TypePackT>
+void run_throughput_for_types(const TypePackT& types) {
+  const auto access_modes = access_modes_pack::generate_named();
+  const auto dimensions = dimensions_pack::generate_unnamed();
+  for_all_combinations<run_throughput>(types, access_modes, dimensions);
+}
+
+}  // namespace generic_accessor_throughput
+
+#endif  // SYCL_CTS_GENERIC_ACCESSOR_THROUGHPUT_H
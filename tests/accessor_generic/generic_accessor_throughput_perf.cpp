@@ -0,0 +1,48 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides throughput measurements for sycl::accessor in device kernels
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+#include "generic_accessor_throughput.h"
+
+namespace generic_accessor_throughput_perf {
+using namespace generic_accessor_throughput;
+
+TEST_CASE("Accessor throughput", "[accessor][performance]") {
+  // Same types as get_std_type in CMake; sycl::half and double are covered
+  // by the _fp16 and _fp64 variants of this file
+#if SYCL_CTS_ENABLE_FULL_CONFORMANCE
+  const auto types =
+      named_type_pack<bool, char, int, float, signed char, unsigned char,
+                      short, unsigned short, unsigned int, long, unsigned long,
+                      long long, unsigned long long>::
+          generate("bool", "char", "int", "float", "signed char",
+                   "unsigned char", "short", "unsigned short", "unsigned int",
+                   "long", "unsigned long", "long long",
+                   "unsigned long long");
+#else
+  const auto types = named_type_pack<bool, char, int, float>::generate(
+      "bool", "char", "int", "float");
+#endif
+  run_throughput_for_types(types);
+}
+
+}  // namespace generic_accessor_throughput_perf
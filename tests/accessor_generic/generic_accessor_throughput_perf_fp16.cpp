@@ -0,0 +1,38 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides throughput measurements for sycl::accessor of sycl::half in device
+//  kernels
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+#include "generic_accessor_throughput.h"
+
+namespace generic_accessor_throughput_perf_fp16 {
+using namespace generic_accessor_throughput;
+
+TEST_CASE("Accessor throughput for sycl::half", "[accessor][performance]") {
+  auto queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::fp16)) {
+    SKIP("Device does not support half precision floating point operations.");
+  }
+  run_throughput_for_types(named_type_pack<sycl::half>::generate("sycl::half"));
+}
+
+}  // namespace generic_accessor_throughput_perf_fp16
@@ -39,7 +39,7 @@ class atomic_ref_T_op_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description = get_section_name(
+    const std::string& description = get_section_name(
         type_name, memory_order, memory_scope, address_space,
         "Check if operator T() const loads the value of the object"
         " referenced by this atomic_ref in device code");
@@ -88,7 +88,7 @@ class atomic_ref_add_sub_op_all_types_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description = get_section_name(
+    const std::string& description = get_section_name(
         type_name, memory_order, memory_scope, address_space,
         "Check if operator+=()/operator-=() adds/subtract the operand to the "
         "object referenced by this atomic_ref"
@@ -45,19 +45,23 @@ constexpr int changed_val = 1;
  * @param memory_scope_name String with name of the testing memory_scope
  * @param address_space String with name of the address_space
  * @param section_description String with human-readable description of the test
- * @return std::string String with name for section
+ * @return const std::string& Interned string with name for section
  */
-inline std::string get_section_name(const std::string& type_name,
-                                    const std::string& memory_order_name,
-                                    const std::string& memory_scope_name,
-                                    const std::string& address_space_name,
-                                    const std::string& section_description) {
-  return section_name(section_description)
-      .with("T", type_name)
-      .with("memory_order", memory_order_name)
-      .with("memory_scope", memory_scope_name)
-      .with("address_space", address_space_name)
-      .create();
+inline const std::string& get_section_name(
+    const std::string& type_name, const std::string& memory_order_name,
+    const std::string& memory_scope_name, const std::string& address_space_name,
+    const std::string& section_description) {
+  return intern_section_name(
+      [&] {
+        return section_name(section_description)
+            .with("T", type_name)
+            .with("memory_order", memory_order_name)
+            .with("memory_scope", memory_scope_name)
+            .with("address_space", address_space_name)
+            .create();
+      },
+      type_name, memory_order_name, memory_scope_name, address_space_name,
+      section_description);
 }
 
 /**
@@ -74,23 +78,27 @@ inline std::string get_section_name(const std::string& type_name,
  * @param momory_scope sycl::memory_scope which will be used as parameter of
  * atomic_ref method
  * @param section_description String with human-readable description of the test
- * @return std::string String with name for section
+ * @return const std::string& Interned string with name for section
  */
-inline std::string get_section_name(const std::string& type_name,
-                                    const std::string& memory_order_name,
-                                    const std::string& memory_scope_name,
-                                    const std::string& address_space_name,
-                                    const sycl::memory_order& memory_order,
-                                    const sycl::memory_scope& memory_scope,
-                                    const std::string& section_description) {
-  return section_name(section_description)
-      .with("T", type_name)
-      .with("memory_order", memory_order_name)
-      .with("memory_scope", memory_scope_name)
-      .with("address_space", address_space_name)
-      .with("memory_order arg", memory_order)
-      .with("memory_scope arg", memory_scope)
-      .create();
+inline const std::string& get_section_name(
+    const std::string& type_name, const std::string& memory_order_name,
+    const std::string& memory_scope_name, const std::string& address_space_name,
+    const sycl::memory_order& memory_order,
+    const sycl::memory_scope& memory_scope,
+    const std::string& section_description) {
+  return intern_section_name(
+      [&] {
+        return section_name(section_description)
+            .with("T", type_name)
+            .with("memory_order", memory_order_name)
+            .with("memory_scope", memory_scope_name)
+            .with("address_space", address_space_name)
+            .with("memory_order arg", memory_order)
+            .with("memory_scope arg", memory_scope)
+            .create();
+      },
+      type_name, memory_order_name, memory_scope_name, address_space_name,
+      memory_order, memory_scope, section_description);
 }
 
 /**
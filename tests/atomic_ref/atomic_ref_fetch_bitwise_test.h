@@ -91,7 +91,7 @@ class atomic_ref_fetch_bitwise_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description = get_section_name(
+    const std::string& description = get_section_name(
         type_name, memory_order, memory_scope, address_space, memory_order_val,
         memory_scope_val,
         "Check fetch_xor(), fetch_or(), fetch_and() methods in device code");
@@ -120,7 +120,7 @@ class atomic_ref_fetch_min_max_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description =
+    const std::string& description =
         get_section_name(type_name, memory_order, memory_scope, address_space,
                          memory_order_val, memory_scope_val,
                          "Check if fetch_min()/fetch_max() method compute "
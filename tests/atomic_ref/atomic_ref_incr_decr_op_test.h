@@ -109,7 +109,7 @@ class atomic_ref_incr_decr_op_test
                          base::memory_order_for_atomic_ref_obj,
                      sycl::memory_scope memory_scope_val =
                          base::memory_scope_for_atomic_ref_obj) {
-    std::string description =
+    const std::string& description =
         get_section_name(type_name, memory_order, memory_scope, address_space,
                          "Check increment/decrement operators in device code");
     auto incr_op_test = [](T val_expd, T val_chgd,
@@ -24,7 +24,11 @@
 
 #include "../common/common.h"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 namespace buffer_storage_common {
 using namespace sycl_cts;
@@ -148,5 +152,252 @@ public:
   }
 };
 
+/**
+ * @brief Host allocation statistics shared between copies of counting_alloc
+ */
+struct allocation_stats {
+  size_t allocations = 0;
+  size_t allocated_bytes = 0;
+  size_t live_bytes = 0;
+  size_t peak_live_bytes = 0;
+  size_t phase_peak_live_bytes = 0;
+  std::mutex mutex;
+
+  void reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    allocations = 0;
+    allocated_bytes = 0;
+    peak_live_bytes = live_bytes;
+    phase_peak_live_bytes = live_bytes;
+  }
+
+  std::string to_string() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::to_string(allocations) + " allocation(s), " +
+           std::to_string(allocated_bytes) + " bytes allocated, " +
+           std::to_string(peak_live_bytes) + " bytes peak";
+  }
+};
+
+/**
+ * @brief Allocator that forwards to sycl::buffer_allocator and records every
+ *        host allocation the runtime makes for the buffer
+ */
+template <typename T>
+class counting_alloc {
+ public:
+  typedef T value_type;
+
+  template <typename U>
+  struct rebind {
+    using other = counting_alloc<U>;
+  };
+
+  explicit counting_alloc(allocation_stats &stats) : m_stats(&stats) {}
+
+  template <typename U>
+  counting_alloc(const counting_alloc<U> &other) : m_stats(other.stats()) {}
+
+  T *allocate(size_t n) {
+    T *mem = m_alloc.allocate(n);
+    std::lock_guard<std::mutex> lock(m_stats->mutex);
+    ++m_stats->allocations;
+    m_stats->allocated_bytes += n * sizeof(T);
+    m_stats->live_bytes += n * sizeof(T);
+    m_stats->peak_live_bytes =
+        std::max(m_stats->peak_live_bytes, m_stats->live_bytes);
+    m_stats->phase_peak_live_bytes =
+        std::max(m_stats->phase_peak_live_bytes, m_stats->live_bytes);
+    return mem;
+  }
+
+  void deallocate(T *p, size_t n) {
+    m_alloc.deallocate(p, n);
+    std::lock_guard<std::mutex> lock(m_stats->mutex);
+    m_stats->live_bytes -= n * sizeof(T);
+  }
+
+  allocation_stats *stats() const { return m_stats; }
+
+  template <typename U>
+  bool operator==(const counting_alloc<U> &other) const {
+    return m_stats == other.stats();
+  }
+
+  template <typename U>
+  bool operator!=(const counting_alloc<U> &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  sycl::buffer_allocator<T> m_alloc;
+  allocation_stats *m_stats;
+};
+
+template <int variant>
+class kernel_buffer_storage_copies;
+
+/**
+ * @brief Host allocation statistics of one phase of a buffer lifetime, counted
+ *        from the end of the previous phase
+ */
+struct storage_phase {
+  std::string name;
+  size_t allocations;
+  size_t allocated_bytes;
+  size_t peak_live_bytes;
+};
+
+/**
+ * @brief Checks write-back of a large buffer with a counting allocator and
+ *        collects the host memory the runtime allocates through it during
+ *        construction, device access and destruction
+ * @details The specification requires that no host allocation is made with
+ *          property::buffer::use_host_ptr. A buffer without a host pointer
+ *          that is only written with no_init has no host data to preserve,
+ *          so it is also checked to allocate no more than the single host
+ *          copy its host accessor reads. The statistics of the other phases
+ *          are collected for the performance tests, which report them
+ *          without asserting.
+ */
+class check_buffer_storage_copies {
+  using T = int;
+  using alloc = counting_alloc<T>;
+  using buffer_t = sycl::buffer<T, 1, alloc>;
+
+  static constexpr T initial_value = 1;
+  static constexpr T written_value = 2;
+
+  sycl::queue m_queue = util::get_cts_object::queue();
+  size_t m_size;
+  size_t m_bytes;
+  allocation_stats m_stats;
+  std::vector<storage_phase> m_phases;
+  size_t m_phase_allocations = 0;
+  size_t m_phase_allocated_bytes = 0;
+
+  template <int variant, typename... AccPropsT>
+  void write_on_device(buffer_t &buf, const AccPropsT &...props) {
+    m_queue
+        .submit([&](sycl::handler &cgh) {
+          sycl::accessor acc(buf, cgh, sycl::write_only, props...);
+          cgh.parallel_for<kernel_buffer_storage_copies<variant>>(
+              sycl::range<1>(m_size),
+              [=](sycl::id<1> idx) { acc[idx] = written_value; });
+        })
+        .wait_and_throw();
+  }
+
+  void check_values(const T *data, T expected, const std::string &what) {
+    const auto mismatch =
+        std::find_if(data, data + m_size, [=](T v) { return v != expected; });
+    INFO(what);
+    CHECK(mismatch == data + m_size);
+  }
+
+  void begin_scenario() {
+    m_stats.reset();
+    m_phase_allocations = 0;
+    m_phase_allocated_bytes = 0;
+  }
+
+  void record_phase(const std::string &name) {
+    std::lock_guard<std::mutex> lock(m_stats.mutex);
+    m_phases.push_back(storage_phase{
+        name, m_stats.allocations - m_phase_allocations,
+        m_stats.allocated_bytes - m_phase_allocated_bytes,
+        m_stats.phase_peak_live_bytes});
+    m_phase_allocations = m_stats.allocations;
+    m_phase_allocated_bytes = m_stats.allocated_bytes;
+    m_stats.phase_peak_live_bytes = m_stats.live_bytes;
+  }
+
+ public:
+  explicit check_buffer_storage_copies(size_t preferred_bytes) {
+    const uint64_t max_alloc =
+        m_queue.get_device().get_info<sycl::info::device::max_mem_alloc_size>();
+    m_bytes = std::min<uint64_t>(preferred_bytes, max_alloc / 4);
+    m_size = m_bytes / sizeof(T);
+    m_bytes = m_size * sizeof(T);
+  }
+
+  size_t payload_bytes() const { return m_bytes; }
+
+  const std::vector<storage_phase> &phases() const { return m_phases; }
+
+  void operator()(util::logger &log) {
+    std::unique_ptr<T[]> host_data(new T[m_size]);
+    std::unique_ptr<T[]> final_data(new T[m_size]);
+    m_phases.clear();
+
+    {
+      INFO("use_host_ptr");
+      std::fill(host_data.get(), host_data.get() + m_size, initial_value);
+      begin_scenario();
+      {
+        buffer_t buf(host_data.get(), sycl::range<1>(m_size), alloc(m_stats),
+                     {sycl::property::buffer::use_host_ptr()});
+        write_on_device<0>(buf);
+        sycl::host_accessor acc(buf, sycl::read_only);
+        check_values(acc.get_pointer(), written_value, "host accessor");
+      }
+      record_phase("use_host_ptr, destruction");
+      INFO(m_stats.to_string());
+      CHECK(m_stats.allocations == 0);
+      check_values(host_data.get(), written_value, "write-back");
+    }
+
+    {
+      INFO("no host pointer, no_init");
+      begin_scenario();
+      {
+        buffer_t buf(sycl::range<1>(m_size), alloc(m_stats));
+        record_phase("no host pointer, construction");
+        write_on_device<1>(buf, sycl::no_init);
+        record_phase("no host pointer, device accessor");
+        sycl::host_accessor acc(buf, sycl::read_only);
+        check_values(acc.get_pointer(), written_value, "host accessor");
+        record_phase("no host pointer, host accessor");
+      }
+      record_phase("no host pointer, destruction");
+      INFO(m_stats.to_string());
+      CHECK(m_stats.allocated_bytes <= m_bytes);
+    }
+
+    {
+      INFO("host pointer, write-back disabled");
+      std::fill(host_data.get(), host_data.get() + m_size, initial_value);
+      begin_scenario();
+      {
+        buffer_t buf(host_data.get(), sycl::range<1>(m_size), alloc(m_stats));
+        buf.set_write_back(false);
+        record_phase("no write-back, construction");
+        write_on_device<2>(buf, sycl::no_init);
+        record_phase("no write-back, device accessor");
+      }
+      record_phase("no write-back, destruction");
+      check_values(host_data.get(), initial_value, "elided write-back");
+    }
+
+    {
+      INFO("const host pointer, set_final_data");
+      std::fill(host_data.get(), host_data.get() + m_size, initial_value);
+      std::fill(final_data.get(), final_data.get() + m_size, initial_value);
+      begin_scenario();
+      {
+        const T *const_data = host_data.get();
+        buffer_t buf(const_data, sycl::range<1>(m_size), alloc(m_stats));
+        buf.set_final_data(final_data.get());
+        record_phase("set_final_data, construction");
+        write_on_device<3>(buf);
+        record_phase("set_final_data, device accessor");
+      }
+      record_phase("set_final_data, destruction");
+      check_values(host_data.get(), initial_value, "const host data");
+      check_values(final_data.get(), written_value, "final data");
+    }
+  }
+};
+
 } // namespace
 #endif // __SYCLCTS_TESTS_BUFFER_STORAGE_COMMON_H
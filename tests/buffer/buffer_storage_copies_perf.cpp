@@ -0,0 +1,51 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Reports host allocations the runtime makes for a large buffer
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+#include "../common/performance.h"
+#include "buffer_storage_common.h"
+
+namespace buffer_storage_copies_perf {
+using namespace sycl_cts;
+
+// Large payload, so redundant host copies are clearly visible
+constexpr size_t payload_bytes = 64 * 1024 * 1024;
+
+TEST_CASE("Host allocations of buffers by storage mode",
+          "[buffer][performance]") {
+  util::logger log;
+  buffer_storage_common::check_buffer_storage_copies check_copies(
+      payload_bytes);
+  check_copies(log);
+
+  // A peak of one payload means a single host copy was alive at a time
+  const double payload = static_cast<double>(check_copies.payload_bytes());
+  for (const auto& phase : check_copies.phases()) {
+    performance::result("buffer", phase.name)
+        .with("allocations", static_cast<double>(phase.allocations), "")
+        .with("allocated", phase.allocated_bytes / payload, "payloads")
+        .with("peak live", phase.peak_live_bytes / payload, "payloads")
+        .record();
+  }
+}
+
+}  // namespace buffer_storage_copies_perf
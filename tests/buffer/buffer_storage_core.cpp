@@ -76,6 +76,11 @@ public:
       for_all_types<buffer_storage_common::check_buffer_storage_for_type>(
           get_buffer_types::scalar_types, log);
     }
+    {
+      buffer_storage_common::check_buffer_storage_copies check_copies(
+          1024 * 1024);
+      check_copies(log);
+    }
   }
 };
 
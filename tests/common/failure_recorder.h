@@ -0,0 +1,119 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Allocation-free recording of verification failures
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_COMMON_FAILURE_RECORDER_H
+#define __SYCLCTS_TESTS_COMMON_FAILURE_RECORDER_H
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_tostring.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+namespace sycl_cts {
+
+/**
+ * @brief Collects verification failures of per-element checks without
+ *        building any message on the success path
+ * @details Intended to replace INFO + CHECK pairs inside loops over large
+ *          result sets, where Catch2 would otherwise construct the message
+ *          strings for every element. Failures are stored in a fixed-size
+ *          ring buffer, so only the last \p Capacity ones are kept; the total
+ *          count is always tracked. Messages are formatted only by report().
+ *
+ *          Usage example:
+ *
+ *              failure_recorder<int> failures;
+ *              for (size_t i = 0; i < size; ++i)
+ *                failures.check_equal("inclusive_scan", i, res[i], ref[i]);
+ *              failures.report("Operator: " + op_name);
+ *
+ * @tparam ValueT Type of the compared values
+ * @tparam Capacity Maximum number of failures kept for the report
+ */
+template <typename ValueT, std::size_t Capacity = 16>
+class failure_recorder {
+  static_assert(Capacity > 0, "Capacity should be greater than zero");
+
+ public:
+  struct entry {
+    /** Description of the check, should point to a string literal */
+    const char* what;
+    std::size_t index;
+    ValueT value;
+    ValueT expected;
+  };
+
+  /**
+   * @brief Records a failure if \p passed is false
+   * @param what Description of the check; the pointer is stored as is, so it
+   *             should outlive the recorder
+   * @return \p passed
+   */
+  bool check(bool passed, const char* what, std::size_t index,
+             const ValueT& value, const ValueT& expected) {
+    if (!passed) {
+      m_entries[m_count % Capacity] = entry{what, index, value, expected};
+      ++m_count;
+    }
+    return passed;
+  }
+
+  bool check_equal(const char* what, std::size_t index, const ValueT& value,
+                   const ValueT& expected) {
+    return check(value == expected, what, index, value, expected);
+  }
+
+  std::size_t count() const { return m_count; }
+
+  bool empty() const { return m_count == 0; }
+
+  void clear() { m_count = 0; }
+
+  /**
+   * @brief Reports all recorded failures as a single Catch2 check
+   * @param context Additional information appended to the report, e.g. the
+   *                operator or types under test
+   */
+  void report(const std::string& context = {}) const {
+    if (empty()) {
+      SUCCEED();
+      return;
+    }
+    FAIL_CHECK(format(context));
+  }
+
+  std::string format(const std::string& context = {}) const {
+    const std::size_t shown = std::min(m_count, Capacity);
+
+    std::ostringstream message;
+    message << m_count << " verification failure(s)";
+    if (!context.empty()) message << " (" << context << ")";
+    if (shown < m_count) message << ", last " << shown << " shown";
+    message << ':';
+    for (std::size_t i = m_count - shown; i < m_count; ++i) {
+      const entry& e = m_entries[i % Capacity];
+      message << "\n  " << e.what << " for element " << e.index
+              << ": result " << Catch::StringMaker<ValueT>::convert(e.value)
+              << ", expected "
+              << Catch::StringMaker<ValueT>::convert(e.expected);
+    }
+    return message.str();
+  }
+
+ private:
+  std::array<entry, Capacity> m_entries{};
+  std::size_t m_count = 0;
+};
+
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_TESTS_COMMON_FAILURE_RECORDER_H
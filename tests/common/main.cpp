@@ -15,6 +15,7 @@
 #include <catch2/internal/catch_clara.hpp>
 
 #include "./../../util/device_manager.h"
+#include "./../../util/performance_report.h"
 #include "cts_selector.h"
 
 int main(int argc, char** argv) {
@@ -25,6 +26,7 @@ int main(int argc, char** argv) {
 
   std::string devicePattern;
   std::string infoDumpFile;
+  std::string perfReportFile;
   bool listDevices = false;
 
   using namespace Catch::Clara;
@@ -37,6 +39,8 @@ int main(int argc, char** argv) {
              Opt(listDevices)["--list-devices"]("List all available devices") |
              Opt(infoDumpFile, "file")["--info-dump"](
                  "Dump platform and device info to file") |
+             Opt(perfReportFile, "file")["--perf-report"](
+                 "Write results of performance test cases to file as JSON") |
              session.cli();
 
   session.cli(cli);
@@ -60,5 +64,10 @@ int main(int argc, char** argv) {
     device_mngr.dump_info(infoDumpFile);
   }
 
-  return session.run();
+  auto& perf_report = util::get<util::performance_report>();
+  perf_report.set_output_file(perfReportFile);
+
+  const int result = session.run();
+  perf_report.write();
+  return result;
 }
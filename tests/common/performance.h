@@ -0,0 +1,235 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_COMMON_PERFORMANCE_H
+#define __SYCLCTS_TESTS_COMMON_PERFORMANCE_H
+
+#include <catch2/catch_test_macros.hpp>
+#include <sycl/sycl.hpp>
+
+#include "../../util/performance_report.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Helpers for performance test cases.
+ *
+ * Performance test cases live in translation units with the `_perf.cpp`
+ * suffix, or `_perf_fp16.cpp` and `_perf_fp64.cpp` for sycl::half and double,
+ * which are only compiled if SYCL_CTS_ENABLE_PERFORMANCE_TESTS is enabled,
+ * and use the `[performance]` tag. They still verify the results of
+ * the measured work, but never fail because of the measured numbers alone.
+ */
+namespace sycl_cts::performance {
+
+using clock = std::chrono::steady_clock;
+
+/**
+ * @brief Summary of repeated wall-clock time measurements in microseconds
+ */
+struct timing {
+  double min = 0;
+  double median = 0;
+  double mean = 0;
+  size_t samples = 0;
+};
+
+/**
+ * @brief Returns the time in microseconds elapsed since \p start
+ */
+inline double elapsed_us(clock::time_point start) {
+  return std::chrono::duration<double, std::micro>(clock::now() - start)
+      .count();
+}
+
+/**
+ * @brief Measures the wall-clock time of a single call of \p f
+ * @return Elapsed time in microseconds
+ */
+template <typename FunctorT>
+double time_us(FunctorT&& f) {
+  const auto start = clock::now();
+  f();
+  return elapsed_us(start);
+}
+
+/**
+ * @brief Computes min, median and mean of the given samples in microseconds
+ */
+inline timing summarize(std::vector<double> samples_us) {
+  timing result;
+  result.samples = samples_us.size();
+  if (samples_us.empty()) return result;
+
+  std::sort(samples_us.begin(), samples_us.end());
+  const size_t mid = samples_us.size() / 2;
+  result.min = samples_us.front();
+  result.median = samples_us.size() % 2 == 0
+                      ? (samples_us[mid - 1] + samples_us[mid]) / 2
+                      : samples_us[mid];
+  result.mean = std::accumulate(samples_us.begin(), samples_us.end(), 0.0) /
+                samples_us.size();
+  return result;
+}
+
+/**
+ * @brief Calls \p f \p warmup times without measuring, then measures \p samples
+ *        calls of \p f
+ * @details \p f has to wait for all the work it submits, otherwise only the
+ *          submission is measured.
+ */
+template <typename FunctorT>
+timing measure(FunctorT&& f, size_t samples = 5, size_t warmup = 1) {
+  for (size_t i = 0; i < warmup; ++i) f();
+
+  std::vector<double> samples_us;
+  samples_us.reserve(samples);
+  for (size_t i = 0; i < samples; ++i) samples_us.push_back(time_us(f));
+  return summarize(std::move(samples_us));
+}
+
+/**
+ * @brief Like measure(), but calls \p setup without measuring before every
+ *        call of \p f, e.g. to restore the input data
+ */
+template <typename SetupT, typename FunctorT>
+timing measure_with_setup(SetupT&& setup, FunctorT&& f, size_t samples = 5,
+                          size_t warmup = 1) {
+  for (size_t i = 0; i < warmup; ++i) {
+    setup();
+    f();
+  }
+
+  std::vector<double> samples_us;
+  samples_us.reserve(samples);
+  for (size_t i = 0; i < samples; ++i) {
+    setup();
+    samples_us.push_back(time_us(f));
+  }
+  return summarize(std::move(samples_us));
+}
+
+/**
+ * @brief Measures the time per command of submitting \p count commands with
+ *        \p submit and waiting for all of them on \p queue
+ * @details The whole batch is measured, so the result includes the amortized
+ *          execution of the commands, which is negligible for trivial ones.
+ */
+template <typename SubmitT>
+timing measure_commands(sycl::queue& queue, size_t count, SubmitT&& submit,
+                        size_t samples = 3, size_t warmup = 1) {
+  timing t = measure(
+      [&] {
+        for (size_t i = 0; i < count; ++i) submit();
+        queue.wait_and_throw();
+      },
+      samples, warmup);
+  t.min /= count;
+  t.median /= count;
+  t.mean /= count;
+  return t;
+}
+
+/**
+ * @brief Converts the number of bytes processed in \p us microseconds into
+ *        GB/s
+ */
+inline double bandwidth_gbs(size_t bytes, double us) {
+  return us > 0 ? static_cast<double>(bytes) / (us * 1e3) : 0;
+}
+
+/**
+ * @brief Converts the number of bytes processed per sample of \p t into GB/s
+ * @details Rates are always derived from the median, so the bandwidths of
+ *          all suites in the `--perf-report` file are comparable
+ */
+inline double bandwidth_gbs(size_t bytes, const timing& t) {
+  return bandwidth_gbs(bytes, t.median);
+}
+
+/**
+ * @brief Returns \p preferred_bytes, limited to a quarter of the maximum
+ *        allocation size of \p device so several buffers of that size fit
+ */
+inline size_t limit_alloc_size(const sycl::device& device,
+                               size_t preferred_bytes) {
+  const uint64_t max_alloc =
+      device.get_info<sycl::info::device::max_mem_alloc_size>();
+  const uint64_t limit = std::max<uint64_t>(max_alloc / 4, 1);
+  return static_cast<size_t>(std::min<uint64_t>(preferred_bytes, limit));
+}
+
+/**
+ * @brief Builder for a single performance result with the fluent interface
+ * @details record() prints the result as a Catch2 warning, so it shows up in
+ *          the console output, and adds it to util::performance_report for the
+ *          `--perf-report` JSON file.
+ *
+ *          Usage example:
+ *
+ *              const auto t = performance::measure(run_kernel);
+ *              performance::result("accessor", "read_write, int, 1D")
+ *                  .with("kernel", t)
+ *                  .with("bandwidth", bandwidth_gbs(bytes, t), "GB/s")
+ *                  .record();
+ */
+class result {
+  util::performance_report::entry m_entry;
+
+ public:
+  result(std::string suite, std::string name)
+      : m_entry{std::move(suite), std::move(name), {}} {}
+
+  result& with(std::string metric, double value, std::string unit) {
+    m_entry.metrics.push_back({std::move(metric), value, std::move(unit)});
+    return *this;
+  }
+
+  /**
+   * @brief Adds median and min of \p t as `<prefix>` and `<prefix> min`
+   */
+  result& with(const std::string& prefix, const timing& t) {
+    with(prefix, t.median, "us");
+    with(prefix + " min", t.min, "us");
+    return *this;
+  }
+
+  void record() {
+    std::ostringstream message;
+    message << "[" << m_entry.suite << "] " << m_entry.name << ":";
+    for (const auto& m : m_entry.metrics)
+      message << "\n  " << m.name << ": " << m.value << " " << m.unit;
+    WARN(message.str());
+
+    util::get<util::performance_report>().add(std::move(m_entry));
+  }
+};
+
+}  // namespace sycl_cts::performance
+
+#endif  // __SYCLCTS_TESTS_COMMON_PERFORMANCE_H
@@ -7,7 +7,11 @@
 #ifndef __SYCLCTS_TESTS_COMMON_SECTION_NAME_BUILDER_H
 #define __SYCLCTS_TESTS_COMMON_SECTION_NAME_BUILDER_H
 
-#include <sstream>
+#include <functional>
+#include <map>
+#include <string>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace sycl_cts {
@@ -22,38 +26,74 @@ namespace sycl_cts {
  */
 class section_name {
   std::string m_description;
-  std::ostringstream m_parameters;
+  std::string m_parameters;
 
  public:
-  section_name(const section_name& other)
-      : m_description(other.m_description),
-        m_parameters(other.m_parameters.str()) {}
-
-  // Avoid implicit move constructor removal
-  section_name(section_name&& other) = default;
-
   section_name(const std::string& description) : m_description(description) {}
 
   template <typename T>
   section_name& with(const std::string& name, T&& value) {
-    m_parameters << ' ' << name << ": "
-                 << Catch::StringMaker<T>::convert(std::forward<T>(value))
-                 << ',';
+    m_parameters += ' ';
+    m_parameters += name;
+    m_parameters += ": ";
+    m_parameters += Catch::StringMaker<T>::convert(std::forward<T>(value));
+    m_parameters += ',';
     return *this;
   }
 
   std::string create() const {
-    std::string result(m_description);
-
-    const auto parameters = m_parameters.str();
-    if (!parameters.empty()) {
+    std::string result;
+    if (m_parameters.empty()) {
+      result = m_description;
+    } else {
       // remove last comma and re-use first space from parameters
-      result += " with" + parameters + "\b \b";
+      result.reserve(m_description.size() + 5 + m_parameters.size() + 3);
+      result += m_description;
+      result += " with";
+      result += m_parameters;
+      result += "\b \b";
     }
     return result;
   }
 };
 
+/**
+ * @brief Returns the section name built by \p factory, calling it only once
+ *        for each unique set of \p key values
+ * @details Catch2 runs a test case once per leaf section and evaluates every
+ *          SECTION name on each run, whether the section is entered or not.
+ *          Interning the names turns all but the first evaluation into a
+ *          lookup that neither formats nor allocates.
+ *
+ *          The cache is local to the \p factory type, so each call site using
+ *          a lambda gets its own cache. The returned reference stays valid
+ *          until the program exits.
+ *
+ *          Usage example:
+ *
+ *              SECTION(intern_section_name(
+ *                  [&] {
+ *                    return section_name("Check foo")
+ *                        .with("T", type_name)
+ *                        .create();
+ *                  },
+ *                  type_name)) { ... }
+ *
+ * @param factory Callable returning the section name as std::string
+ * @param key Values the section name depends on, compared by value
+ */
+template <typename FactoryT, typename... KeyT>
+const std::string& intern_section_name(FactoryT&& factory, const KeyT&... key) {
+  using storage_key_t = std::tuple<std::decay_t<KeyT>...>;
+  static std::map<storage_key_t, std::string, std::less<>> names;
+
+  auto it = names.find(std::forward_as_tuple(key...));
+  if (it == names.end()) {
+    it = names.emplace(storage_key_t(key...), factory()).first;
+  }
+  return it->second;
+}
+
 }  // namespace sycl_cts
 
 #endif  // __SYCLCTS_TESTS_COMMON_SECTION_NAME_BUILDER_H
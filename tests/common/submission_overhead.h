@@ -0,0 +1,155 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Submission overhead of extension command APIs compared to queue::submit
+//  and the queue shortcut functions
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_COMMON_SUBMISSION_OVERHEAD_H
+#define __SYCLCTS_TESTS_COMMON_SUBMISSION_OVERHEAD_H
+
+#include <catch2/catch_test_macros.hpp>
+#include <sycl/sycl.hpp>
+
+#include "get_cts_object.h"
+#include "performance.h"
+
+#include <string>
+
+namespace sycl_cts::submission_overhead {
+
+constexpr size_t commands_per_batch = 100'000;
+constexpr int memcpy_value = 314;
+
+/**
+ * @brief Kernel of the measured launches, counts how often it ran
+ */
+struct increment_kernel {
+  int* counter;
+
+  void operator()() const {
+    sycl::atomic_ref<int, sycl::memory_order::relaxed,
+                     sycl::memory_scope::device,
+                     sycl::access::address_space::global_space>(*counter)++;
+  }
+};
+
+/**
+ * @brief Measures the submission overhead of the commands of an extension
+ *        and of the equivalent queue::submit and queue shortcut commands on
+ *        \p q, then verifies that all of them ran
+ * @tparam ExtensionT Provides static members, each *_name naming the command
+ *         submitted by the function of the same name without the suffix:
+ *         - submit_task(q, kernel): extension submit with a kernel launched
+ *           through the handler
+ *         - task(q, kernel): kernel launch directly on the queue
+ *         - submit_memcpy(q, dst, src, bytes) and memcpy(q, dst, src, bytes)
+ *           likewise for a USM memcpy
+ *         - barrier(q), only used if has_barrier is true
+ * @param suite Name of the performance result suite
+ */
+template <typename ExtensionT>
+void run(sycl::queue& q, const std::string& suite,
+         const std::string& queue_name) {
+  int* counter = sycl::malloc_device<int>(1, q);
+  int* src = sycl::malloc_device<int>(1, q);
+  int* dst = sycl::malloc_device<int>(1, q);
+  REQUIRE((counter != nullptr && src != nullptr && dst != nullptr));
+  q.fill(counter, 0, 1);
+  q.fill(src, memcpy_value, 1);
+  q.fill(dst, 0, 1);
+  q.wait_and_throw();
+
+  const increment_kernel kernel{counter};
+  int launched = 0;
+
+  auto report = [&](const std::string& api, auto submit) {
+    const auto t =
+        performance::measure_commands(q, commands_per_batch, submit);
+    performance::result(suite, queue_name + ", " + api)
+        .with("per command", t)
+        .record();
+  };
+
+  report("queue::submit + handler::single_task", [&] {
+    q.submit([&](sycl::handler& h) { h.single_task(kernel); });
+    ++launched;
+  });
+  report("queue::single_task", [&] {
+    q.single_task(kernel);
+    ++launched;
+  });
+  report(ExtensionT::submit_task_name, [&] {
+    ExtensionT::submit_task(q, kernel);
+    ++launched;
+  });
+  report(ExtensionT::task_name, [&] {
+    ExtensionT::task(q, kernel);
+    ++launched;
+  });
+
+  report("queue::submit + handler::memcpy", [&] {
+    q.submit([&](sycl::handler& h) { h.memcpy(dst, src, sizeof(int)); });
+  });
+  report("queue::memcpy", [&] { q.memcpy(dst, src, sizeof(int)); });
+  report(ExtensionT::submit_memcpy_name,
+         [&] { ExtensionT::submit_memcpy(q, dst, src, sizeof(int)); });
+  report(ExtensionT::memcpy_name,
+         [&] { ExtensionT::memcpy(q, dst, src, sizeof(int)); });
+
+  if constexpr (ExtensionT::has_barrier) {
+    // Core SYCL has no barrier command, an empty command group is the
+    // closest equivalent
+    report("queue::submit with empty command group",
+           [&] { q.submit([](sycl::handler&) {}); });
+    report(ExtensionT::barrier_name, [&] { ExtensionT::barrier(q); });
+  }
+
+  int counter_value = 0;
+  int dst_value = 0;
+  q.copy(counter, &counter_value, 1);
+  q.copy(dst, &dst_value, 1);
+  q.wait_and_throw();
+  CHECK(counter_value == launched);
+  CHECK(dst_value == memcpy_value);
+
+  sycl::free(counter, q);
+  sycl::free(src, q);
+  sycl::free(dst, q);
+}
+
+/**
+ * @brief Runs the comparison on an in-order and an out-of-order queue
+ */
+template <typename ExtensionT>
+void run_on_queues(const std::string& suite) {
+  auto q = util::get_cts_object::queue();
+  SECTION("In-order queue") {
+    sycl::queue in_order_q{q.get_context(), q.get_device(),
+                           sycl::property::queue::in_order{}};
+    run<ExtensionT>(in_order_q, suite, "in-order queue");
+  }
+  SECTION("Out-of-order queue") {
+    run<ExtensionT>(q, suite, "out-of-order queue");
+  }
+}
+
+}  // namespace sycl_cts::submission_overhead
+
+#endif  // __SYCLCTS_TESTS_COMMON_SUBMISSION_OVERHEAD_H
@@ -0,0 +1,94 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+#include "event_profiling.h"
+
+#include <vector>
+
+namespace event_profiling::tests {
+using namespace sycl_cts;
+
+// Busy loop iterations of the kernels whose timestamps are checked
+constexpr uint64_t busy_iterations[] = {1 << 10, 1 << 14, 1 << 18};
+
+constexpr size_t back_to_back_kernels = 16;
+
+static sycl::queue make_profiling_queue(const sycl::device& device) {
+  return sycl::queue(device, {sycl::property::queue::enable_profiling(),
+                              sycl::property::queue::in_order()});
+}
+
+TEST_CASE("event profiling timestamps of kernels are ordered", "[event]") {
+  const auto device = sycl::device{cts_selector};
+  if (!device.has(sycl::aspect::queue_profiling)) {
+    SKIP("Device does not have sycl::aspect::queue_profiling");
+  }
+  auto queue = make_profiling_queue(device);
+  uint32_t* out = sycl::malloc_device<uint32_t>(1, queue);
+  REQUIRE(out != nullptr);
+
+  for (const uint64_t iterations : busy_iterations) {
+    INFO("busy loop iterations: " << iterations);
+    sycl::event event = submit_busy_kernel(queue, iterations, out);
+    event.wait_and_throw();
+
+    uint32_t result = 0;
+    queue.copy(out, &result, 1).wait_and_throw();
+    CHECK(result == busy_kernel_result(iterations));
+    const profile p = get_profile(event);
+    CHECK(p.submit <= p.start);
+    CHECK(p.start <= p.end);
+  }
+
+  sycl::free(out, queue);
+}
+
+TEST_CASE("event profiling timestamps are ordered within an in-order queue",
+          "[event]") {
+  const auto device = sycl::device{cts_selector};
+  if (!device.has(sycl::aspect::queue_profiling)) {
+    SKIP("Device does not have sycl::aspect::queue_profiling");
+  }
+  auto queue = make_profiling_queue(device);
+  uint32_t* out = sycl::malloc_device<uint32_t>(back_to_back_kernels, queue);
+  REQUIRE(out != nullptr);
+
+  std::vector<sycl::event> events;
+  for (size_t i = 0; i < back_to_back_kernels; ++i)
+    events.push_back(submit_busy_kernel(queue, 1024 * (i + 1), out + i));
+  queue.wait_and_throw();
+
+  profile previous{};
+  for (size_t i = 0; i < events.size(); ++i) {
+    INFO("kernel " << i);
+    const profile p = get_profile(events[i]);
+    CHECK(p.submit <= p.start);
+    CHECK(p.start <= p.end);
+    if (i > 0) {
+      CHECK(previous.submit <= p.submit);
+      CHECK(previous.end <= p.start);
+    }
+    previous = p;
+  }
+  sycl::free(out, queue);
+}
+
+}  // namespace event_profiling::tests
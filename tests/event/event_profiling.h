@@ -0,0 +1,96 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Calibrated busy kernels for checking event profiling information
+//
+*******************************************************************************/
+
+#ifndef SYCL_CTS_EVENT_EVENT_PROFILING_H
+#define SYCL_CTS_EVENT_EVENT_PROFILING_H
+
+#include "../common/common.h"
+
+#include <chrono>
+#include <cstdint>
+
+namespace event_profiling {
+
+using clock = std::chrono::steady_clock;
+
+/**
+ * @brief Profiling information of a completed event in nanoseconds
+ */
+struct profile {
+  uint64_t submit;
+  uint64_t start;
+  uint64_t end;
+
+  uint64_t duration() const { return end - start; }
+};
+
+inline profile get_profile(const sycl::event& event) {
+  return {
+      event.get_profiling_info<sycl::info::event_profiling::command_submit>(),
+      event.get_profiling_info<sycl::info::event_profiling::command_start>(),
+      event.get_profiling_info<sycl::info::event_profiling::command_end>()};
+}
+
+/**
+ * @brief Submits a single work-item kernel which runs a dependent chain of
+ *        \p iterations integer operations and stores the result to \p out
+ */
+inline sycl::event submit_busy_kernel(sycl::queue& queue, uint64_t iterations,
+                                      uint32_t* out) {
+  return queue.single_task([=] {
+    uint32_t value = static_cast<uint32_t>(iterations);
+    for (uint64_t i = 0; i < iterations; ++i) value = value * 1664525u + 1;
+    *out = value;
+  });
+}
+
+/**
+ * @brief Host result of submit_busy_kernel() used to verify that the loop was
+ *        not shortened
+ */
+inline uint32_t busy_kernel_result(uint64_t iterations) {
+  uint32_t value = static_cast<uint32_t>(iterations);
+  for (uint64_t i = 0; i < iterations; ++i) value = value * 1664525u + 1;
+  return value;
+}
+
+/**
+ * @brief Returns the number of iterations for which the busy kernel takes at
+ *        least \p target of wall-clock time on the host, including the launch
+ */
+inline uint64_t calibrate_busy_kernel(sycl::queue& queue, uint32_t* out,
+                                      std::chrono::microseconds target) {
+  uint64_t iterations = 1024;
+  // Keep doubling, but stop at a limit that is slow on any device
+  constexpr uint64_t max_iterations = uint64_t{1} << 36;
+  while (iterations < max_iterations) {
+    const auto start = clock::now();
+    submit_busy_kernel(queue, iterations, out).wait_and_throw();
+    if (clock::now() - start >= target) break;
+    iterations *= 2;
+  }
+  return iterations;
+}
+
+}  // namespace event_profiling
+
+#endif  // SYCL_CTS_EVENT_EVENT_PROFILING_H
@@ -0,0 +1,208 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+#include "../common/performance.h"
+#include "event_profiling.h"
+
+#include <chrono>
+#include <vector>
+
+namespace event_profiling::tests {
+using namespace sycl_cts;
+
+constexpr size_t overhead_commands = 10000;
+constexpr size_t overhead_samples = 3;
+constexpr size_t overhead_warmup = 1;
+constexpr auto discrepancy_target = std::chrono::milliseconds(10);
+constexpr size_t discrepancy_samples = 10;
+
+// Kernels of the accuracy measurement run at least this long, so launch
+// overhead is small compared to the kernel itself
+constexpr auto accuracy_target = std::chrono::milliseconds(20);
+// Profiled durations are expected within this range of the host measurement
+// plus the slack, and four times the work within the scaling range; results
+// outside of them are reported as warnings
+constexpr double max_duration_ratio = 1.1;
+constexpr double duration_slack_ns = 1e6;
+constexpr double min_duration_ratio = 0.25;
+constexpr double min_scaling = 2;
+constexpr double max_scaling = 8;
+
+TEST_CASE("event profiling submission overhead", "[event][performance]") {
+  const auto device = sycl::device{cts_selector};
+  if (!device.has(sycl::aspect::queue_profiling)) {
+    SKIP("Device does not have sycl::aspect::queue_profiling");
+  }
+
+  for (const bool in_order : {false, true}) {
+    namespace props = sycl::property::queue;
+    sycl::queue plain_queue =
+        in_order ? sycl::queue(device, {props::in_order()})
+                 : sycl::queue(device);
+    // Same context, so the counter can be used on both queues
+    const sycl::context context = plain_queue.get_context();
+    sycl::queue profiling_queue =
+        in_order ? sycl::queue(context, device,
+                               {props::in_order(), props::enable_profiling()})
+                 : sycl::queue(context, device, {props::enable_profiling()});
+
+    uint32_t* counter = sycl::malloc_device<uint32_t>(1, plain_queue);
+    REQUIRE(counter != nullptr);
+    const auto run = [&](sycl::queue& queue) {
+      plain_queue.fill(counter, uint32_t{0}, 1).wait_and_throw();
+      const auto t = performance::measure_commands(
+          queue, overhead_commands,
+          [&] {
+            queue.single_task([=] {
+              sycl::atomic_ref<uint32_t, sycl::memory_order::relaxed,
+                               sycl::memory_scope::device>(*counter)++;
+            });
+          },
+          overhead_samples, overhead_warmup);
+      uint32_t count = 0;
+      plain_queue.copy(counter, &count, 1).wait_and_throw();
+      CHECK(count == (overhead_warmup + overhead_samples) * overhead_commands);
+      return t;
+    };
+    const auto without = run(plain_queue);
+    const auto with = run(profiling_queue);
+    sycl::free(counter, plain_queue);
+
+    // Querying the profiling information of a completed event
+    std::vector<sycl::event> events;
+    events.reserve(overhead_commands);
+    for (size_t i = 0; i < overhead_commands; ++i)
+      events.push_back(profiling_queue.single_task([] {}));
+    profiling_queue.wait_and_throw();
+    uint64_t ordered = 0;
+    const double query_us = performance::time_us([&] {
+      for (const auto& event : events) {
+        const profile p = get_profile(event);
+        ordered += p.submit <= p.start && p.start <= p.end;
+      }
+    });
+    CHECK(ordered == events.size());
+
+    performance::result(
+        "event", std::string(in_order ? "in-order" : "out-of-order") +
+                     " queue, " + std::to_string(overhead_commands) +
+                     " kernels")
+        .with("without profiling per command", without)
+        .with("with profiling per command", with)
+        .with("overhead",
+              without.median > 0 ? with.median / without.median : 0, "x")
+        .with("profiling query per event", query_us / events.size(), "us")
+        .record();
+  }
+}
+
+TEST_CASE("event profiling discrepancy from host time",
+          "[event][performance]") {
+  const auto device = sycl::device{cts_selector};
+  if (!device.has(sycl::aspect::queue_profiling)) {
+    SKIP("Device does not have sycl::aspect::queue_profiling");
+  }
+  sycl::queue queue(device, {sycl::property::queue::enable_profiling(),
+                             sycl::property::queue::in_order()});
+  uint32_t* out = sycl::malloc_device<uint32_t>(1, queue);
+  REQUIRE(out != nullptr);
+
+  const uint64_t iterations =
+      calibrate_busy_kernel(queue, out, discrepancy_target);
+  std::vector<double> host_minus_device_us;
+  std::vector<double> submit_to_start_us;
+  for (size_t i = 0; i < discrepancy_samples; ++i) {
+    sycl::event event;
+    const double host_us = performance::time_us([&] {
+      event = submit_busy_kernel(queue, iterations, out);
+      event.wait_and_throw();
+    });
+    const profile p = get_profile(event);
+    CHECK(p.submit <= p.start);
+    CHECK(p.start <= p.end);
+    host_minus_device_us.push_back(host_us - p.duration() / 1e3);
+    submit_to_start_us.push_back((p.start - p.submit) / 1e3);
+  }
+  sycl::free(out, queue);
+
+  performance::result("event", "busy kernel of " +
+                                   std::to_string(discrepancy_target.count()) +
+                                   " ms")
+      .with("host minus profiled duration",
+            performance::summarize(host_minus_device_us))
+      .with("submit to start", performance::summarize(submit_to_start_us))
+      .record();
+}
+
+TEST_CASE("event profiling accuracy for kernels of known duration",
+          "[event][performance]") {
+  const auto device = sycl::device{cts_selector};
+  if (!device.has(sycl::aspect::queue_profiling)) {
+    SKIP("Device does not have sycl::aspect::queue_profiling");
+  }
+  sycl::queue queue(device, {sycl::property::queue::enable_profiling(),
+                             sycl::property::queue::in_order()});
+  uint32_t* out = sycl::malloc_device<uint32_t>(1, queue);
+  REQUIRE(out != nullptr);
+
+  const uint64_t base = calibrate_busy_kernel(queue, out, accuracy_target);
+  std::vector<double> durations_ns;
+  for (const uint64_t factor : {1, 2, 4}) {
+    const uint64_t iterations = base * factor;
+    sycl::event event;
+    const double host_ns = 1e3 * performance::time_us([&] {
+      event = submit_busy_kernel(queue, iterations, out);
+      event.wait_and_throw();
+    });
+    uint32_t result = 0;
+    queue.copy(out, &result, 1).wait_and_throw();
+    CHECK(result == busy_kernel_result(iterations));
+
+    const double duration_ns =
+        static_cast<double>(get_profile(event).duration());
+    durations_ns.push_back(duration_ns);
+    const double ratio = host_ns > 0 ? duration_ns / host_ns : 0;
+    performance::result("event", std::to_string(factor) + "x busy kernel")
+        .with("host", host_ns / 1e3, "us")
+        .with("profiled", duration_ns / 1e3, "us")
+        .with("profiled / host", ratio, "x")
+        .record();
+    if (duration_ns > host_ns * max_duration_ratio + duration_slack_ns ||
+        ratio < min_duration_ratio) {
+      WARN("profiled duration of " << duration_ns << " ns is far from the "
+                                   << "host measurement of " << host_ns
+                                   << " ns");
+    }
+  }
+  sycl::free(out, queue);
+
+  const double scaling =
+      durations_ns[0] > 0 ? durations_ns[2] / durations_ns[0] : 0;
+  performance::result("event", "busy kernel scaling")
+      .with("4x work", scaling, "x")
+      .record();
+  if (scaling < min_scaling || scaling > max_scaling) {
+    WARN("four times the work took " << scaling
+                                     << " times as long in profiled time");
+  }
+}
+
+}  // namespace event_profiling::tests
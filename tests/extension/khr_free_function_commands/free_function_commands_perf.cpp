@@ -0,0 +1,76 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../../common/common.h"
+#include "../../common/submission_overhead.h"
+
+namespace free_function_commands_perf::tests {
+
+#ifdef SYCL_KHR_FREE_FUNCTION_COMMANDS
+/**
+ * @brief Free function commands compared by submission_overhead::run
+ */
+struct free_function_commands {
+  static constexpr const char* submit_task_name =
+      "khr::submit + khr::launch_task";
+  static constexpr const char* task_name = "khr::launch_task";
+  static constexpr const char* submit_memcpy_name =
+      "khr::submit + khr::memcpy";
+  static constexpr const char* memcpy_name = "khr::memcpy";
+  static constexpr bool has_barrier = true;
+  static constexpr const char* barrier_name = "khr::command_barrier";
+
+  template <typename KernelT>
+  static void submit_task(sycl::queue& q, const KernelT& kernel) {
+    sycl::khr::submit(
+        q, [&](sycl::handler& h) { sycl::khr::launch_task(h, kernel); });
+  }
+
+  template <typename KernelT>
+  static void task(sycl::queue& q, const KernelT& kernel) {
+    sycl::khr::launch_task(q, kernel);
+  }
+
+  static void submit_memcpy(sycl::queue& q, void* dst, const void* src,
+                            size_t bytes) {
+    sycl::khr::submit(
+        q, [&](sycl::handler& h) { sycl::khr::memcpy(h, dst, src, bytes); });
+  }
+
+  static void memcpy(sycl::queue& q, void* dst, const void* src,
+                     size_t bytes) {
+    sycl::khr::memcpy(q, dst, src, bytes);
+  }
+
+  static void barrier(sycl::queue& q) { sycl::khr::command_barrier(q); }
+};
+#endif  // SYCL_KHR_FREE_FUNCTION_COMMANDS
+
+TEST_CASE("Submission overhead of SYCL_KHR_FREE_FUNCTION_COMMANDS",
+          "[SYCL_KHR_FREE_FUNCTION_COMMANDS][performance]") {
+#ifndef SYCL_KHR_FREE_FUNCTION_COMMANDS
+  SKIP("SYCL_KHR_FREE_FUNCTION_COMMANDS is not defined");
+#else
+  sycl_cts::submission_overhead::run_on_queues<free_function_commands>(
+      "khr_free_function_commands");
+#endif  // SYCL_KHR_FREE_FUNCTION_COMMANDS
+}
+
+}  // namespace free_function_commands_perf::tests
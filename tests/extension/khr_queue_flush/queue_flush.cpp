@@ -19,7 +19,10 @@
 *******************************************************************************/
 
 #include "../../common/common.h"
+#include <atomic>
+#include <chrono>
 #include <future>
+#include <thread>
 
 namespace queue_flush::tests {
 
@@ -53,4 +56,28 @@ TEST_CASE("Flush and host task", "[khr_queue_flush]") {
   q.wait();
 }
 
+TEST_CASE("Flush starts a long batch without waiting", "[khr_queue_flush]") {
+  constexpr size_t batch_size = 10'000;
+  constexpr auto timeout = std::chrono::seconds(60);
+
+  sycl::queue q{sycl::property::queue::in_order{}};
+  std::atomic<bool> started = false;
+  std::atomic<bool> finished = false;
+
+  q.submit([&](sycl::handler& cgh) { cgh.host_task([&] { started = true; }); });
+  for (size_t i = 0; i < batch_size; ++i) q.single_task([] {});
+  q.submit(
+      [&](sycl::handler& cgh) { cgh.host_task([&] { finished = true; }); });
+  q.khr_flush();
+
+  // After the flush all the commands have to make progress without any
+  // further synchronization with the queue
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (!finished && std::chrono::steady_clock::now() < deadline)
+    std::this_thread::yield();
+  CHECK(started);
+  CHECK(finished);
+  q.wait();
+}
+
 }  // namespace queue_flush::tests
@@ -0,0 +1,112 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../../common/common.h"
+#include "../../common/performance.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace queue_flush_perf::tests {
+using namespace sycl_cts;
+
+constexpr size_t batch_size = 10'000;
+constexpr size_t samples = 5;
+constexpr auto lazy_start_timeout = std::chrono::seconds(1);
+
+struct batch_latency {
+  /** Time spent submitting the batch */
+  double submission_us;
+  /** Time from the return of the first submit to the start of its command */
+  double first_execution_us;
+  /** Whether the first command started before the queue was waited on */
+  bool started_before_wait;
+};
+
+/**
+ * @brief Submits a batch to an in-order queue, headed by a host task that
+ *        observes when the work actually starts
+ * @details Without flush the first command may not start until the queue is
+ *          waited on, so the queue is waited on after lazy_start_timeout.
+ */
+static batch_latency run_batch(sycl::queue& q, bool flush) {
+  std::atomic<bool> started = false;
+  performance::clock::time_point start_time;
+
+  const auto submission_start = performance::clock::now();
+  q.submit([&](sycl::handler& cgh) {
+    cgh.host_task([&] {
+      start_time = performance::clock::now();
+      started = true;
+    });
+  });
+  const auto head_submitted = performance::clock::now();
+  for (size_t i = 1; i < batch_size; ++i) q.single_task([] {});
+  if (flush) q.khr_flush();
+  const auto submission_end = performance::clock::now();
+
+  const auto deadline = submission_end + lazy_start_timeout;
+  while (!started && performance::clock::now() < deadline)
+    std::this_thread::yield();
+  const bool started_before_wait = started;
+  q.wait_and_throw();
+  CHECK(started);
+
+  // An eager runtime may start the host task before submit even returns
+  using us = std::chrono::duration<double, std::micro>;
+  const double first_execution_us =
+      std::max(0.0, us(start_time - head_submitted).count());
+  return {us(submission_end - submission_start).count(), first_execution_us,
+          started_before_wait};
+}
+
+TEST_CASE("Time to first execution with and without flush",
+          "[khr_queue_flush][performance]") {
+  sycl::queue q{util::get_cts_object::queue().get_device(),
+                sycl::property::queue::in_order{}};
+
+  for (const bool flush : {false, true}) {
+    // Warm up the queue and the kernel
+    run_batch(q, flush);
+
+    std::vector<double> submission_us;
+    std::vector<double> first_execution_us;
+    size_t started_before_wait = 0;
+    for (size_t i = 0; i < samples; ++i) {
+      const auto latency = run_batch(q, flush);
+      submission_us.push_back(latency.submission_us);
+      first_execution_us.push_back(latency.first_execution_us);
+      started_before_wait += latency.started_before_wait;
+    }
+
+    performance::result("khr_queue_flush",
+                        flush ? "batch with khr_flush" : "batch without flush")
+        .with("submission", performance::summarize(submission_us))
+        .with("first execution after its submit",
+              performance::summarize(first_execution_us))
+        .with("started before wait", started_before_wait,
+              "of " + std::to_string(samples))
+        .record();
+  }
+}
+
+}  // namespace queue_flush_perf::tests
@@ -0,0 +1,103 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures the throughput of conversions between float and bfloat16
+//
+*******************************************************************************/
+
+#include "../../common/common.h"
+#include "../../common/failure_recorder.h"
+#include "../../common/performance.h"
+#include "bfloat16_reference.h"
+
+#include <cmath>
+#include <vector>
+
+namespace bfloat16_conversion_perf {
+using bfloat16 = sycl::ext::oneapi::bfloat16;
+using namespace sycl_cts;
+using namespace bfloat16_reference;
+
+constexpr size_t preferred_count = 64 * 1024 * 1024;
+
+TEST_CASE("Throughput of bfloat16 conversions", "[bfloat16][performance]") {
+  auto q = util::get_cts_object::queue();
+  const size_t count =
+      performance::limit_alloc_size(q.get_device(),
+                                    preferred_count * sizeof(float)) /
+      sizeof(float);
+
+  // Inputs cover all bfloat16 patterns with varying low halves
+  std::vector<float> input(count);
+  for (size_t i = 0; i < count; ++i)
+    input[i] = bits_to_float(static_cast<uint32_t>(i * 2654435761u));
+
+  float* floats = sycl::malloc_device<float>(count, q);
+  bfloat16* bf16s = sycl::malloc_device<bfloat16>(count, q);
+  float* roundtrip = sycl::malloc_device<float>(count, q);
+  REQUIRE((floats && bf16s && roundtrip));
+  q.copy(input.data(), floats, count).wait_and_throw();
+
+  const auto to_bf16 = performance::measure([&] {
+    q.parallel_for(sycl::range<1>(count), [=](sycl::id<1> i) {
+       bf16s[i] = bfloat16(floats[i]);
+     }).wait_and_throw();
+  });
+  const auto to_float = performance::measure([&] {
+    q.parallel_for(sycl::range<1>(count), [=](sycl::id<1> i) {
+       roundtrip[i] = static_cast<float>(bf16s[i]);
+     }).wait_and_throw();
+  });
+
+  const size_t bytes = count * (sizeof(float) + sizeof(bfloat16));
+  performance::result("bfloat16", "float to bfloat16")
+      .with("kernel", to_bf16)
+      .with("conversion rate", count / to_bf16.median, "conversions/us")
+      .with("bandwidth", performance::bandwidth_gbs(bytes, to_bf16),
+            "GB/s")
+      .record();
+  performance::result("bfloat16", "bfloat16 to float")
+      .with("kernel", to_float)
+      .with("conversion rate", count / to_float.median, "conversions/us")
+      .with("bandwidth", performance::bandwidth_gbs(bytes, to_float),
+            "GB/s")
+      .record();
+
+  std::vector<float> result(count);
+  q.copy(roundtrip, result.data(), count).wait_and_throw();
+  sycl::free(floats, q);
+  sycl::free(bf16s, q);
+  sycl::free(roundtrip, q);
+
+  // Subnormal values are skipped, the exhaustive test covers them
+  failure_recorder<uint32_t> failures;
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t input_bits = float_bits(input[i]);
+    if (is_subnormal_float(input_bits)) continue;
+    const uint16_t expected = to_bf16_rne(input[i]);
+    const uint32_t result_bits = float_bits(result[i]);
+    const bool passed = is_nan(expected)
+                            ? std::isnan(result[i])
+                            : result_bits == uint32_t(expected) << 16;
+    failures.check(passed, "float to bfloat16 to float", i, result_bits,
+                   uint32_t(expected) << 16);
+  }
+  failures.report();
+}
+
+}  // namespace bfloat16_conversion_perf
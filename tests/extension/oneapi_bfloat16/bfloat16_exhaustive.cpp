@@ -0,0 +1,236 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Checks conversions and arithmetic of bfloat16 for all 65536 bit patterns
+//  against a host reference rounding to nearest even
+//
+*******************************************************************************/
+
+#include "../../common/common.h"
+#include "../../common/failure_recorder.h"
+#include "bfloat16_reference.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <initializer_list>
+#include <vector>
+
+namespace bfloat16_exhaustive {
+using bfloat16 = sycl::ext::oneapi::bfloat16;
+using namespace sycl_cts;
+using namespace bfloat16_reference;
+
+constexpr size_t patterns = 1 << 16;
+
+// Low halves appended to every bfloat16 pattern to get floats which are exact,
+// just above, just below, exactly at and just above the rounding midpoint and
+// just below the next bfloat16 value
+constexpr size_t low_half_count = 6;
+// Besides a pseudo-random partner, every pattern is combined with 1.0, -3.0
+// and the bfloat16 value nearest to 0.1
+constexpr size_t operand_count = 4;
+enum arith_op : size_t { op_add, op_sub, op_mul, op_div, op_count };
+
+inline uint32_t low_half(size_t index) {
+  switch (index) {
+    case 0:
+      return 0x0000;
+    case 1:
+      return 0x0001;
+    case 2:
+      return 0x7FFF;
+    case 3:
+      return 0x8000;
+    case 4:
+      return 0x8001;
+    default:
+      return 0xFFFF;
+  }
+}
+
+inline uint16_t operand(size_t pattern, size_t index) {
+  switch (index) {
+    case 0:
+      return static_cast<uint16_t>((pattern * 40503 + 12345) & 0xFFFF);
+    case 1:
+      return 0x3F80;
+    case 2:
+      return 0xC040;
+    default:
+      return 0x3DCD;
+  }
+}
+
+inline float apply(arith_op op, float a, float b) {
+  switch (op) {
+    case op_add:
+      return a + b;
+    case op_sub:
+      return a - b;
+    case op_mul:
+      return a * b;
+    default:
+      return a / b;
+  }
+}
+
+/**
+ * @brief Device results of the sweep, indexed as described by the kernel
+ */
+struct results {
+  std::vector<uint32_t> to_float;
+  std::vector<uint16_t> roundtrip;
+  std::vector<uint16_t> from_float;
+  std::vector<uint16_t> arithmetic;
+};
+
+results run_sweep(sycl::queue& q) {
+  results host{std::vector<uint32_t>(patterns),
+               std::vector<uint16_t>(patterns),
+               std::vector<uint16_t>(patterns * low_half_count),
+               std::vector<uint16_t>(patterns * operand_count * op_count)};
+
+  uint32_t* to_float = sycl::malloc_device<uint32_t>(patterns, q);
+  uint16_t* roundtrip = sycl::malloc_device<uint16_t>(patterns, q);
+  uint16_t* from_float =
+      sycl::malloc_device<uint16_t>(host.from_float.size(), q);
+  uint16_t* arithmetic =
+      sycl::malloc_device<uint16_t>(host.arithmetic.size(), q);
+  REQUIRE((to_float && roundtrip && from_float && arithmetic));
+
+  q.parallel_for(sycl::range<1>(patterns), [=](sycl::id<1> idx) {
+     const size_t p = idx[0];
+     const bfloat16 a = sycl::bit_cast<bfloat16>(static_cast<uint16_t>(p));
+     const float a_float = a;
+     to_float[p] = sycl::bit_cast<uint32_t>(a_float);
+     roundtrip[p] = sycl::bit_cast<uint16_t>(bfloat16(a_float));
+
+     for (size_t l = 0; l < low_half_count; ++l) {
+       const float f = sycl::bit_cast<float>(
+           static_cast<uint32_t>(p << 16) | low_half(l));
+       from_float[p * low_half_count + l] =
+           sycl::bit_cast<uint16_t>(bfloat16(f));
+     }
+
+     for (size_t j = 0; j < operand_count; ++j) {
+       const bfloat16 b = sycl::bit_cast<bfloat16>(operand(p, j));
+       uint16_t* out = arithmetic + (p * operand_count + j) * op_count;
+       out[op_add] = sycl::bit_cast<uint16_t>(bfloat16(a + b));
+       out[op_sub] = sycl::bit_cast<uint16_t>(bfloat16(a - b));
+       out[op_mul] = sycl::bit_cast<uint16_t>(bfloat16(a * b));
+       out[op_div] = sycl::bit_cast<uint16_t>(bfloat16(a / b));
+     }
+   }).wait_and_throw();
+
+  q.copy(to_float, host.to_float.data(), host.to_float.size());
+  q.copy(roundtrip, host.roundtrip.data(), host.roundtrip.size());
+  q.copy(from_float, host.from_float.data(), host.from_float.size());
+  q.copy(arithmetic, host.arithmetic.data(), host.arithmetic.size());
+  q.wait_and_throw();
+
+  sycl::free(to_float, q);
+  sycl::free(roundtrip, q);
+  sycl::free(from_float, q);
+  sycl::free(arithmetic, q);
+  return host;
+}
+
+/**
+ * @brief Compares bfloat16 bits with the reference, any NaN matches a NaN
+ * @param tolerance Maximum distance in units in the last place
+ */
+bool matches(uint16_t result, uint16_t expected, int tolerance = 0) {
+  if (is_nan(expected)) return is_nan(result);
+  if (result == expected) return true;
+  // Adjacent values of the same sign differ by one in their bits
+  return tolerance > 0 && (result & 0x8000) == (expected & 0x8000) &&
+         std::abs(int(result) - int(expected)) <= tolerance;
+}
+
+TEST_CASE("Exhaustive bfloat16 conversions and arithmetic", "[bfloat16]") {
+  auto q = util::get_cts_object::queue();
+  // Devices without denormal support may flush subnormal floats, which
+  // includes all subnormal bfloat16 values
+  const auto fp_config =
+      q.get_device().get_info<sycl::info::device::single_fp_config>();
+  const bool has_denorm =
+      std::find(fp_config.begin(), fp_config.end(),
+                sycl::info::fp_config::denorm) != fp_config.end();
+  const auto skip = [&](std::initializer_list<uint32_t> float_bits) {
+    if (has_denorm) return false;
+    for (const uint32_t bits : float_bits)
+      if (is_subnormal_float(bits)) return true;
+    return false;
+  };
+
+  const results res = run_sweep(q);
+
+  failure_recorder<uint32_t> to_float_failures;
+  failure_recorder<uint32_t> from_float_failures;
+  failure_recorder<uint32_t> arithmetic_failures;
+  for (size_t p = 0; p < patterns; ++p) {
+    const uint16_t a = static_cast<uint16_t>(p);
+    const uint32_t a_bits = static_cast<uint32_t>(p) << 16;
+    if (!skip({a_bits})) {
+      const bool nan = is_nan(a);
+      to_float_failures.check(
+          nan ? std::isnan(bits_to_float(res.to_float[p]))
+              : res.to_float[p] == a_bits,
+          "bfloat16 to float", p, res.to_float[p], a_bits);
+      to_float_failures.check(matches(res.roundtrip[p], a),
+                              "float to bfloat16 round trip", p,
+                              res.roundtrip[p], a);
+    }
+
+    for (size_t l = 0; l < low_half_count; ++l) {
+      const uint32_t f_bits = a_bits | low_half(l);
+      if (skip({f_bits})) continue;
+      const size_t i = p * low_half_count + l;
+      const uint16_t expected = to_bf16_rne(bits_to_float(f_bits));
+      from_float_failures.check(matches(res.from_float[i], expected),
+                                "float to bfloat16", i, res.from_float[i],
+                                expected);
+    }
+
+    for (size_t j = 0; j < operand_count; ++j) {
+      const uint16_t b = operand(p, j);
+      for (size_t op = 0; op < op_count; ++op) {
+        const float exact =
+            apply(static_cast<arith_op>(op), to_float(a), to_float(b));
+        if (skip({a_bits, static_cast<uint32_t>(b) << 16, float_bits(exact)}))
+          continue;
+        const size_t i = (p * operand_count + j) * op_count + op;
+        const uint16_t expected = to_bf16_rne(exact);
+        // Single precision division on the device is not required to be
+        // correctly rounded, which can move the result by one bfloat16 ulp
+        const int tolerance = op == op_div ? 1 : 0;
+        static constexpr const char* names[] = {"a + b", "a - b", "a * b",
+                                                "a / b"};
+        arithmetic_failures.check(
+            matches(res.arithmetic[i], expected, tolerance), names[op], i,
+            res.arithmetic[i], expected);
+      }
+    }
+  }
+  to_float_failures.report("bfloat16 to float");
+  from_float_failures.report("float to bfloat16");
+  arithmetic_failures.report("arithmetic");
+}
+
+}  // namespace bfloat16_exhaustive
@@ -0,0 +1,76 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides host reference implementations of bfloat16 conversions
+//
+*******************************************************************************/
+
+#ifndef SYCL_CTS_TEST_BFLOAT16_REFERENCE_H
+#define SYCL_CTS_TEST_BFLOAT16_REFERENCE_H
+
+#include <cstdint>
+#include <cstring>
+
+namespace bfloat16_reference {
+
+inline uint32_t float_bits(float f) {
+  uint32_t bits;
+  std::memcpy(&bits, &f, sizeof(bits));
+  return bits;
+}
+
+inline float bits_to_float(uint32_t bits) {
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+/**
+ * @brief Exact conversion of bfloat16 bits to float
+ */
+inline float to_float(uint16_t bf16_bits) {
+  return bits_to_float(static_cast<uint32_t>(bf16_bits) << 16);
+}
+
+inline bool is_nan(uint16_t bf16_bits) {
+  return (bf16_bits & 0x7F80) == 0x7F80 && (bf16_bits & 0x007F) != 0;
+}
+
+/**
+ * @brief Checks whether \p bits encode a subnormal float, or a bfloat16 if
+ *        shifted
+ */
+inline bool is_subnormal_float(uint32_t bits) {
+  return (bits & 0x7F800000) == 0 && (bits & 0x007FFFFF) != 0;
+}
+
+/**
+ * @brief Converts \p f to bfloat16 bits, rounding to nearest even
+ * @details NaNs are converted to a quiet NaN with the same sign.
+ */
+inline uint16_t to_bf16_rne(float f) {
+  const uint32_t bits = float_bits(f);
+  if ((bits & 0x7F800000) == 0x7F800000 && (bits & 0x007FFFFF) != 0)
+    return static_cast<uint16_t>((bits >> 16) | 0x0040);
+  const uint32_t rounding_bias = 0x7FFF + ((bits >> 16) & 1);
+  return static_cast<uint16_t>((bits + rounding_bias) >> 16);
+}
+
+}  // namespace bfloat16_reference
+
+#endif  // SYCL_CTS_TEST_BFLOAT16_REFERENCE_H
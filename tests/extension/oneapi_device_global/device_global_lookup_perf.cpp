@@ -0,0 +1,189 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Compares the kernel read throughput of device_global, device_global with
+//  device_image_scope, a USM pointer and a specialization constant holding
+//  the same lookup table
+//
+*******************************************************************************/
+
+#include "../../common/common.h"
+#include "../../common/failure_recorder.h"
+#include "../../common/performance.h"
+#include "../../common/type_coverage.h"
+#include "type_pack.h"
+
+#include <array>
+
+namespace device_global_lookup_perf {
+using namespace sycl_cts;
+
+#if defined(SYCL_EXT_ONEAPI_PROPERTIES) && \
+    defined(SYCL_EXT_ONEAPI_DEVICE_GLOBAL)
+namespace oneapi = sycl::ext::oneapi;
+
+constexpr size_t work_items = 1 << 20;
+constexpr size_t lookups_per_item = 16;
+
+template <typename T, size_t N>
+oneapi::experimental::device_global<T[N]> table_dg;
+
+template <typename T, size_t N>
+oneapi::experimental::device_global<
+    T[N],
+    decltype(oneapi::experimental::properties{
+        oneapi::experimental::device_image_scope})>
+    table_dg_image_scope;
+
+template <typename T, size_t N>
+constexpr sycl::specialization_id<std::array<T, N>> table_sc;
+
+enum class mechanism { device_global, device_image_scope, usm, spec_const };
+
+template <typename T, size_t N, mechanism M>
+class kernel_lookup;
+
+template <typename T, size_t N>
+std::array<T, N> make_table() {
+  std::array<T, N> table{};
+  for (size_t k = 0; k < N; ++k)
+    table[k] = user_def_types::get_init_value<T>(static_cast<int>(k));
+  return table;
+}
+
+template <typename T>
+int to_int(const T& value) {
+  if constexpr (std::is_same_v<T, user_def_types::no_cnstr>)
+    return value.b;
+  else
+    return static_cast<int>(value);
+}
+
+/**
+ * @brief Chain of data-dependent lookups, so none of them can be skipped
+ */
+template <size_t N, typename TableT>
+int lookup_chain(const TableT& table, size_t i) {
+  int acc = 0;
+  size_t k = i % N;
+  for (size_t j = 0; j < lookups_per_item; ++j) {
+    acc += to_int(table[k]);
+    k = (k * 5 + 1 + static_cast<size_t>(acc)) % N;
+  }
+  return acc;
+}
+
+template <typename T, typename SizeT>
+class run_lookup {
+  static constexpr size_t N = SizeT::value;
+
+  template <mechanism M>
+  using kernel = kernel_lookup<T, N, M>;
+
+ public:
+  void operator()(const std::string& type_name) {
+    auto queue = once_per_unit::get_queue();
+    const auto table = make_table<T, N>();
+
+    std::vector<int> expected(work_items);
+    for (size_t i = 0; i < work_items; ++i)
+      expected[i] = lookup_chain<N>(table, i);
+
+    std::vector<int> result(work_items);
+    int* out = sycl::malloc_device<int>(work_items, queue);
+    T* table_usm = sycl::malloc_device<T>(N, queue);
+    REQUIRE((out != nullptr && table_usm != nullptr));
+    queue.copy(table.data(), table_usm, N);
+    queue.copy(table.data(), table_dg<T, N>, N, 0);
+    queue.copy(table.data(), table_dg_image_scope<T, N>, N, 0);
+    queue.wait_and_throw();
+
+    const std::string name =
+        type_name + ", " + std::to_string(N) + " elements";
+    const sycl::range<1> range(work_items);
+
+    auto run = [&](const std::string& mechanism_name, auto submit) {
+      queue.fill(out, 0, work_items).wait_and_throw();
+      const auto t =
+          performance::measure([&] { submit().wait_and_throw(); });
+      performance::result("device_global lookup", name + ", " + mechanism_name)
+          .with("kernel", t)
+          .with("lookup rate", work_items * lookups_per_item / t.median,
+                "lookups/us")
+          .record();
+
+      queue.copy(out, result.data(), work_items).wait_and_throw();
+      failure_recorder<int> failures;
+      for (size_t i = 0; i < work_items; ++i)
+        failures.check_equal("lookup", i, result[i], expected[i]);
+      failures.report(name + ", " + mechanism_name);
+    };
+
+    SECTION(name) {
+      run("device_global", [&] {
+        return queue.parallel_for<kernel<mechanism::device_global>>(
+            range, [=](sycl::id<1> i) {
+              out[i] = lookup_chain<N>(table_dg<T, N>, i[0]);
+            });
+      });
+      run("device_global with device_image_scope", [&] {
+        return queue.parallel_for<kernel<mechanism::device_image_scope>>(
+            range, [=](sycl::id<1> i) {
+              out[i] = lookup_chain<N>(table_dg_image_scope<T, N>, i[0]);
+            });
+      });
+      run("USM pointer", [&] {
+        const T* ptr = table_usm;
+        return queue.parallel_for<kernel<mechanism::usm>>(
+            range,
+            [=](sycl::id<1> i) { out[i] = lookup_chain<N>(ptr, i[0]); });
+      });
+      run("specialization constant", [&] {
+        return queue.submit([&](sycl::handler& cgh) {
+          cgh.set_specialization_constant<table_sc<T, N>>(table);
+          cgh.parallel_for<kernel<mechanism::spec_const>>(
+              range, [=](sycl::id<1> i, sycl::kernel_handler h) {
+                const auto sc_table =
+                    h.get_specialization_constant<table_sc<T, N>>();
+                out[i] = lookup_chain<N>(sc_table, i[0]);
+              });
+        });
+      });
+    }
+
+    sycl::free(out, queue);
+    sycl::free(table_usm, queue);
+  }
+};
+#endif
+
+TEST_CASE("Read throughput of device_global lookup tables",
+          "[device_global][performance]") {
+#if !defined(SYCL_EXT_ONEAPI_PROPERTIES)
+  SKIP("SYCL_EXT_ONEAPI_PROPERTIES is not defined");
+#elif !defined(SYCL_EXT_ONEAPI_DEVICE_GLOBAL)
+  SKIP("SYCL_EXT_ONEAPI_DEVICE_GLOBAL is not defined");
+#else
+  const auto types = device_global_types::get_types();
+  const auto table_sizes =
+      value_pack<size_t, 16, 256, 4096>::generate_unnamed();
+  for_all_combinations<run_lookup>(types, table_sizes);
+#endif
+}
+
+}  // namespace device_global_lookup_perf
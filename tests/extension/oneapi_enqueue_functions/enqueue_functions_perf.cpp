@@ -0,0 +1,86 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../../common/common.h"
+#include "../../common/submission_overhead.h"
+
+namespace enqueue_functions_perf::tests {
+
+#ifdef SYCL_EXT_ONEAPI_ENQUEUE_FUNCTIONS
+namespace oneapi_ext = sycl::ext::oneapi::experimental;
+
+/**
+ * @brief Enqueue functions compared by submission_overhead::run
+ */
+struct enqueue_functions {
+  static constexpr const char* submit_task_name =
+      "oneapi_ext::submit + oneapi_ext::single_task";
+  static constexpr const char* task_name = "oneapi_ext::single_task";
+  static constexpr const char* submit_memcpy_name =
+      "oneapi_ext::submit + oneapi_ext::memcpy";
+  static constexpr const char* memcpy_name = "oneapi_ext::memcpy";
+#ifdef SYCL_EXT_ONEAPI_ENQUEUE_BARRIER
+  static constexpr bool has_barrier = true;
+#else
+  static constexpr bool has_barrier = false;
+#endif  // SYCL_EXT_ONEAPI_ENQUEUE_BARRIER
+  static constexpr const char* barrier_name = "oneapi_ext::barrier";
+
+  template <typename KernelT>
+  static void submit_task(sycl::queue& q, const KernelT& kernel) {
+    oneapi_ext::submit(
+        q, [&](sycl::handler& h) { oneapi_ext::single_task(h, kernel); });
+  }
+
+  template <typename KernelT>
+  static void task(sycl::queue& q, const KernelT& kernel) {
+    oneapi_ext::single_task(q, kernel);
+  }
+
+  static void submit_memcpy(sycl::queue& q, void* dst, const void* src,
+                            size_t bytes) {
+    oneapi_ext::submit(
+        q, [&](sycl::handler& h) { oneapi_ext::memcpy(h, dst, src, bytes); });
+  }
+
+  static void memcpy(sycl::queue& q, void* dst, const void* src,
+                     size_t bytes) {
+    oneapi_ext::memcpy(q, dst, src, bytes);
+  }
+
+  static void barrier(sycl::queue& q) {
+#ifdef SYCL_EXT_ONEAPI_ENQUEUE_BARRIER
+    oneapi_ext::barrier(q);
+#endif  // SYCL_EXT_ONEAPI_ENQUEUE_BARRIER
+  }
+};
+#endif  // SYCL_EXT_ONEAPI_ENQUEUE_FUNCTIONS
+
+TEST_CASE("Submission overhead of \"Enqueue Functions\" extension",
+          "[oneapi_enqueue_functions][performance]") {
+#ifndef SYCL_EXT_ONEAPI_ENQUEUE_FUNCTIONS
+  SKIP("SYCL_EXT_ONEAPI_ENQUEUE_FUNCTIONS is not defined");
+#else
+  sycl_cts::submission_overhead::run_on_queues<enqueue_functions>(
+      "oneapi_enqueue_functions");
+#endif  // SYCL_EXT_ONEAPI_ENQUEUE_FUNCTIONS
+}
+
+}  // namespace enqueue_functions_perf::tests
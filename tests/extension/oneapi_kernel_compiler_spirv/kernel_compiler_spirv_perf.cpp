@@ -0,0 +1,110 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../../common/common.h"
+#include "../../common/failure_recorder.h"
+#include "../../common/performance.h"
+#include "spirv_module_generator.h"
+
+#include <optional>
+#include <vector>
+
+namespace kernel_compiler_spirv_perf::tests {
+using namespace sycl_cts;
+
+#ifdef SYCL_EXT_ONEAPI_KERNEL_COMPILER_SPIRV
+namespace syclex = sycl::ext::oneapi::experimental;
+namespace gen = kernel_compiler_spirv::generator;
+
+constexpr size_t work_items = 4;
+
+/**
+ * @brief Measures loading and building a generated module, then runs every
+ *        kernel of it and verifies the results
+ */
+static void measure_module(sycl::queue& q, gen::module_params params) {
+  params.address_bits =
+      q.get_device().get_info<sycl::info::device::address_bits>();
+  const std::string name = std::to_string(params.kernels) + " kernels, " +
+                           "call depth " + std::to_string(params.call_depth);
+
+  std::vector<std::byte> module;
+  const double generate_us =
+      performance::time_us([&] { module = gen::generate_module(params); });
+
+  std::optional<sycl::kernel_bundle<sycl::bundle_state::ext_oneapi_source>>
+      source;
+  const double create_us = performance::time_us([&] {
+    source = syclex::create_kernel_bundle_from_source(
+        q.get_context(), syclex::source_language::spirv, module);
+  });
+  std::optional<sycl::kernel_bundle<sycl::bundle_state::executable>> bundle;
+  const double build_us =
+      performance::time_us([&] { bundle = syclex::build(*source); });
+
+  performance::result("kernel_compiler_spirv", name)
+      .with("module size", static_cast<double>(module.size()), "bytes")
+      .with("generate", generate_us, "us")
+      .with("create_kernel_bundle_from_source", create_us, "us")
+      .with("build", build_us, "us")
+      .with("build per kernel", build_us / params.kernels, "us")
+      .record();
+
+  const size_t total = params.kernels * work_items;
+  int* out = sycl::malloc_device<int>(total, q);
+  REQUIRE(out != nullptr);
+  for (size_t k = 0; k < params.kernels; ++k) {
+    const auto kernel_name = gen::kernel_name(k);
+    INFO(kernel_name);
+    REQUIRE(bundle->ext_oneapi_has_kernel(kernel_name));
+    const sycl::kernel kernel = bundle->ext_oneapi_get_kernel(kernel_name);
+    q.submit([&](sycl::handler& cgh) {
+      cgh.set_arg(0, out + k * work_items);
+      cgh.parallel_for(sycl::range<1>{work_items}, kernel);
+    });
+  }
+  std::vector<int> result(total);
+  q.copy(out, result.data(), total).wait_and_throw();
+  sycl::free(out, q);
+
+  failure_recorder<int> failures;
+  for (size_t k = 0; k < params.kernels; ++k)
+    for (size_t id = 0; id < work_items; ++id)
+      failures.check_equal("kernel result", k * work_items + id,
+                           result[k * work_items + id],
+                           gen::expected_value(params, k, id));
+  failures.report(name);
+}
+#endif
+
+TEST_CASE("Load and build time of large SPIR-V modules",
+          "[oneapi_kernel_compiler_spirv][performance]") {
+#ifndef SYCL_EXT_ONEAPI_KERNEL_COMPILER_SPIRV
+  SKIP("SYCL_EXT_ONEAPI_KERNEL_COMPILER_SPIRV is not defined");
+#else
+  sycl::queue q = util::get_cts_object::queue();
+  for (const size_t kernels : {10, 100, 1000, 10000})
+    measure_module(q, {kernels, 64});
+  // Deep call graph, which stresses inlining
+  measure_module(q, {10, 1024});
+#endif
+}
+
+}  // namespace kernel_compiler_spirv_perf::tests
@@ -0,0 +1,274 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides a generator of SPIR-V modules with a configurable number of
+//  kernels and depth of the call graph
+//
+*******************************************************************************/
+
+#ifndef SYCL_CTS_TEST_KERNEL_COMPILER_SPIRV_MODULE_GENERATOR_H
+#define SYCL_CTS_TEST_KERNEL_COMPILER_SPIRV_MODULE_GENERATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace kernel_compiler_spirv::generator {
+
+/**
+ * @brief Parameters of a generated module
+ */
+struct module_params {
+  /** Number of kernels, named by kernel_name() */
+  size_t kernels = 1;
+  /** Depth of the chain of helper functions every kernel calls */
+  size_t call_depth = 1;
+  /** Address width of the device, either 32 or 64 */
+  unsigned address_bits = 64;
+};
+
+inline std::string kernel_name(size_t index) {
+  return "kernel_" + std::to_string(index);
+}
+
+/**
+ * @brief Value the kernel with the given \p index stores for work item \p id
+ * @details Every kernel takes a single `int*` argument and computes
+ *          `out[id] = helper_<depth - 1>(id) + index`, where `helper_0(x)` is
+ *          `x + 1` and `helper_<d>(x)` is `helper_<d - 1>(x) + 1`.
+ */
+inline int32_t expected_value(const module_params& params, size_t index,
+                              size_t id) {
+  return static_cast<int32_t>(id + params.call_depth + index);
+}
+
+namespace detail {
+// Opcodes and enumerants from the SPIR-V specification
+enum op : uint32_t {
+  op_memory_model = 14,
+  op_entry_point = 15,
+  op_capability = 17,
+  op_type_void = 19,
+  op_type_int = 21,
+  op_type_vector = 23,
+  op_type_pointer = 32,
+  op_type_function = 33,
+  op_constant = 43,
+  op_function = 54,
+  op_function_parameter = 55,
+  op_function_end = 56,
+  op_function_call = 57,
+  op_variable = 59,
+  op_load = 61,
+  op_store = 62,
+  op_in_bounds_ptr_access_chain = 70,
+  op_decorate = 71,
+  op_composite_extract = 81,
+  op_u_convert = 113,
+  op_i_add = 128,
+  op_label = 248,
+  op_return = 253,
+  op_return_value = 254,
+};
+
+constexpr uint32_t magic_number = 0x07230203;
+constexpr uint32_t version_1_0 = 0x00010000;
+constexpr uint32_t capability_addresses = 4;
+constexpr uint32_t capability_kernel = 6;
+constexpr uint32_t capability_int64 = 11;
+constexpr uint32_t addressing_physical32 = 1;
+constexpr uint32_t addressing_physical64 = 2;
+constexpr uint32_t memory_model_opencl = 2;
+constexpr uint32_t execution_model_kernel = 6;
+constexpr uint32_t storage_input = 1;
+constexpr uint32_t storage_cross_workgroup = 5;
+constexpr uint32_t decoration_builtin = 11;
+constexpr uint32_t decoration_constant = 22;
+constexpr uint32_t builtin_global_invocation_id = 28;
+constexpr uint32_t function_control_none = 0;
+constexpr uint32_t memory_access_aligned = 2;
+
+class module_builder {
+  std::vector<uint32_t> m_words;
+
+ public:
+  void emit(op opcode, std::initializer_list<uint32_t> operands) {
+    m_words.push_back(static_cast<uint32_t>(operands.size() + 1) << 16 |
+                      opcode);
+    m_words.insert(m_words.end(), operands);
+  }
+
+  /**
+   * @brief Emits an instruction with a literal string between \p before and
+   *        \p after operands
+   */
+  void emit(op opcode, std::initializer_list<uint32_t> before,
+            const std::string& str, const std::vector<uint32_t>& after) {
+    // The string is nul-terminated and padded with zeros to full words
+    const size_t str_words = str.size() / 4 + 1;
+    m_words.push_back(
+        static_cast<uint32_t>(1 + before.size() + str_words + after.size())
+            << 16 |
+        opcode);
+    m_words.insert(m_words.end(), before);
+    const size_t offset = m_words.size();
+    m_words.resize(offset + str_words, 0);
+    for (size_t i = 0; i < str.size(); ++i)
+      m_words[offset + i / 4] |= static_cast<uint32_t>(
+                                     static_cast<unsigned char>(str[i]))
+                                 << (8 * (i % 4));
+    m_words.insert(m_words.end(), after.begin(), after.end());
+  }
+
+  std::vector<uint32_t>& words() { return m_words; }
+};
+}  // namespace detail
+
+/**
+ * @brief Generates a SPIR-V 1.0 module for the OpenCL environment with
+ *        \p params.kernels kernels sharing a chain of \p params.call_depth
+ *        helper functions
+ * @return Module in the little-endian byte order
+ */
+inline std::vector<std::byte> generate_module(const module_params& params) {
+  using namespace detail;
+  const bool is_64bit = params.address_bits == 64;
+  const size_t depth = std::max<size_t>(params.call_depth, 1);
+
+  // Ids of types and global variables
+  uint32_t next_id = 1;
+  const uint32_t void_t = next_id++;
+  const uint32_t i32_t = next_id++;
+  const uint32_t size_t_id = is_64bit ? next_id++ : i32_t;
+  const uint32_t v3size_t = next_id++;
+  const uint32_t ptr_input_v3size_t = next_id++;
+  const uint32_t ptr_global_i32_t = next_id++;
+  const uint32_t kernel_fn_t = next_id++;
+  const uint32_t helper_fn_t = next_id++;
+  const uint32_t global_id_var = next_id++;
+  // Constants 0 .. max(kernels, 2) - 1, one per kernel index
+  const uint32_t first_constant = next_id;
+  const size_t constants = std::max<size_t>(params.kernels, 2);
+  next_id += static_cast<uint32_t>(constants);
+  const uint32_t one = first_constant + 1;
+  const uint32_t first_helper = next_id;
+  next_id += static_cast<uint32_t>(depth);
+  const uint32_t first_kernel = next_id;
+  next_id += static_cast<uint32_t>(params.kernels);
+
+  module_builder module;
+  auto& words = module.words();
+  // Header; the bound is patched in when the module is complete
+  words = {magic_number, version_1_0, 0, 0, 0};
+
+  module.emit(op_capability, {capability_addresses});
+  module.emit(op_capability, {capability_kernel});
+  if (is_64bit) module.emit(op_capability, {capability_int64});
+  module.emit(op_memory_model,
+              {is_64bit ? addressing_physical64 : addressing_physical32,
+               memory_model_opencl});
+  for (size_t k = 0; k < params.kernels; ++k)
+    module.emit(op_entry_point,
+                {execution_model_kernel,
+                 first_kernel + static_cast<uint32_t>(k)},
+                kernel_name(k), {global_id_var});
+
+  module.emit(op_decorate, {global_id_var, decoration_builtin,
+                            builtin_global_invocation_id});
+  module.emit(op_decorate, {global_id_var, decoration_constant});
+
+  module.emit(op_type_void, {void_t});
+  module.emit(op_type_int, {i32_t, 32, 0});
+  if (is_64bit) module.emit(op_type_int, {size_t_id, 64, 0});
+  module.emit(op_type_vector, {v3size_t, size_t_id, 3});
+  module.emit(op_type_pointer, {ptr_input_v3size_t, storage_input, v3size_t});
+  module.emit(op_type_pointer,
+              {ptr_global_i32_t, storage_cross_workgroup, i32_t});
+  module.emit(op_type_function, {kernel_fn_t, void_t, ptr_global_i32_t});
+  module.emit(op_type_function, {helper_fn_t, i32_t, i32_t});
+  for (size_t c = 0; c < constants; ++c)
+    module.emit(op_constant, {i32_t, first_constant + static_cast<uint32_t>(c),
+                              static_cast<uint32_t>(c)});
+  module.emit(op_variable, {ptr_input_v3size_t, global_id_var, storage_input});
+
+  // helper_0(x) = x + 1, helper_d(x) = helper_<d - 1>(x) + 1
+  for (size_t d = 0; d < depth; ++d) {
+    const uint32_t helper = first_helper + static_cast<uint32_t>(d);
+    const uint32_t x = next_id++;
+    const uint32_t label = next_id++;
+    const uint32_t result = next_id++;
+    module.emit(op_function, {i32_t, helper, function_control_none,
+                              helper_fn_t});
+    module.emit(op_function_parameter, {i32_t, x});
+    module.emit(op_label, {label});
+    if (d == 0) {
+      module.emit(op_i_add, {i32_t, result, x, one});
+    } else {
+      const uint32_t call = next_id++;
+      module.emit(op_function_call, {i32_t, call, helper - 1, x});
+      module.emit(op_i_add, {i32_t, result, call, one});
+    }
+    module.emit(op_return_value, {result});
+    module.emit(op_function_end, {});
+  }
+
+  // kernel_k(int* out) { out[id] = helper_<depth - 1>(id) + k; }
+  const uint32_t last_helper = first_helper + static_cast<uint32_t>(depth - 1);
+  for (size_t k = 0; k < params.kernels; ++k) {
+    const uint32_t kernel = first_kernel + static_cast<uint32_t>(k);
+    const uint32_t out = next_id++;
+    const uint32_t label = next_id++;
+    const uint32_t global_id = next_id++;
+    const uint32_t id = next_id++;
+    const uint32_t id_i32 = is_64bit ? next_id++ : id;
+    const uint32_t call = next_id++;
+    const uint32_t value = next_id++;
+    const uint32_t ptr = next_id++;
+    module.emit(op_function, {void_t, kernel, function_control_none,
+                              kernel_fn_t});
+    module.emit(op_function_parameter, {ptr_global_i32_t, out});
+    module.emit(op_label, {label});
+    module.emit(op_load, {v3size_t, global_id, global_id_var});
+    module.emit(op_composite_extract, {size_t_id, id, global_id, 0});
+    if (is_64bit) module.emit(op_u_convert, {i32_t, id_i32, id});
+    module.emit(op_function_call, {i32_t, call, last_helper, id_i32});
+    module.emit(op_i_add, {i32_t, value, call,
+                           first_constant + static_cast<uint32_t>(k)});
+    module.emit(op_in_bounds_ptr_access_chain,
+                {ptr_global_i32_t, ptr, out, id});
+    module.emit(op_store, {ptr, value, memory_access_aligned, 4});
+    module.emit(op_return, {});
+    module.emit(op_function_end, {});
+  }
+
+  words[3] = next_id;
+
+  std::vector<std::byte> bytes(words.size() * sizeof(uint32_t));
+  for (size_t i = 0; i < words.size(); ++i)
+    for (size_t b = 0; b < sizeof(uint32_t); ++b)
+      bytes[i * sizeof(uint32_t) + b] =
+          static_cast<std::byte>((words[i] >> (8 * b)) & 0xFF);
+  return bytes;
+}
+
+}  // namespace kernel_compiler_spirv::generator
+
+#endif  // SYCL_CTS_TEST_KERNEL_COMPILER_SPIRV_MODULE_GENERATOR_H
@@ -0,0 +1,334 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures bandwidth of oneapi_memcpy2d copies and fills over image-sized
+//  regions and compares it with equivalent parallel_for kernels
+//
+*******************************************************************************/
+
+#include "../../common/common.h"
+#include "../../common/failure_recorder.h"
+#include "../../common/performance.h"
+#include "memcpy2d_common.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace memcpy2d_scaling_perf {
+using namespace memcpy2d_common_tests;
+using namespace sycl_cts;
+
+#ifdef SYCL_EXT_ONEAPI_MEMCPY2D
+
+// RGBA8 pixel
+using pixel = uint32_t;
+
+// Width and height of the square regions
+constexpr size_t region_sizes[] = {64, 512, 2048, 8192};
+
+// Row alignment commonly used by image allocators
+constexpr size_t aligned_pitch_bytes = 256;
+
+constexpr pixel sentinel = 0xDEADBEEF;
+constexpr pixel fill_pattern = 0x11223344;
+constexpr int memset_value = 0xAB;
+
+/**
+ * @brief Row pitches in pixels of a copy, which always differ between source
+ *        and destination so a copy cannot be done as a single linear one
+ */
+struct pitches {
+  size_t src;
+  size_t dest;
+};
+
+inline pitches get_pitches(size_t width, bool aligned) {
+  if (aligned) {
+    const size_t row = (width * sizeof(pixel) + aligned_pitch_bytes - 1) /
+                       aligned_pitch_bytes * aligned_pitch_bytes;
+    const size_t dest = row / sizeof(pixel);
+    return {dest + aligned_pitch_bytes / sizeof(pixel), dest};
+  }
+  // Odd numbers of extra pixels break any alignment above that of a pixel
+  return {width + 5, width + 3};
+}
+
+inline pixel pattern(size_t row, size_t col) {
+  return static_cast<pixel>(row * 0x9E3779B1u ^ col * 0x85EBCA77u);
+}
+
+template <pointer_type PtrType>
+void upload(pixel* dest, const std::vector<pixel>& src, sycl::queue& queue) {
+  if constexpr (PtrType == pointer_type::usm_device)
+    queue.copy(src.data(), dest, src.size()).wait_and_throw();
+  else
+    std::copy(src.begin(), src.end(), dest);
+}
+
+/**
+ * @brief Checks every pixel of the destination: the region has to hold
+ *        \p expected, the padding of each row the sentinel
+ */
+template <typename ExpectedT>
+void verify_region(const std::vector<pixel>& dest, size_t dest_pitch,
+                   size_t width, size_t height, ExpectedT&& expected,
+                   const std::string& context) {
+  failure_recorder<pixel> failures;
+  for (size_t row = 0; row < height; ++row) {
+    const pixel* line = dest.data() + row * dest_pitch;
+    for (size_t col = 0; col < dest_pitch; ++col) {
+      const pixel want = col < width ? expected(row, col) : sentinel;
+      if (line[col] != want)
+        failures.check(false, col < width ? "region" : "padding",
+                       row * dest_pitch + col, line[col], want);
+    }
+  }
+  failures.report(context);
+}
+
+/**
+ * @brief Returns whether the copy of a square region of \p size fits into the
+ *        allocation limits of the device
+ */
+inline bool fits(sycl::queue& queue, size_t size) {
+  const size_t bytes = get_pitches(size, true).src * size * sizeof(pixel);
+  return performance::limit_alloc_size(queue.get_device(), bytes) == bytes;
+}
+
+template <typename SrcPtrT, typename DestPtrT>
+class run_copy_scaling {
+  static constexpr pointer_type SrcPtrType = SrcPtrT::value;
+  static constexpr pointer_type DestPtrType = DestPtrT::value;
+  // The hand-written copy needs both pointers to be accessible in kernels
+  static constexpr bool kernel_accessible =
+      SrcPtrType != pointer_type::host && DestPtrType != pointer_type::host;
+
+ public:
+  void operator()(sycl::queue& queue, const std::string& src_ptr_type_name,
+                  const std::string& dest_ptr_type_name) {
+    if (!check_device_aspect_allocations<SrcPtrType, DestPtrType>(queue)) {
+      SKIP("Device does not support the USM allocations. Skipping the test.");
+    }
+
+    for (const size_t size : region_sizes) {
+      if (!fits(queue, size)) {
+        WARN("Region of " << size << "x" << size
+                          << " exceeds the allocation limits, skipped");
+        continue;
+      }
+      for (const bool aligned : {true, false}) {
+        run(queue, size, aligned,
+            src_ptr_type_name + " to " + dest_ptr_type_name + ", " +
+                std::to_string(size) + "x" + std::to_string(size) +
+                (aligned ? ", aligned pitch" : ", unaligned pitch"));
+      }
+    }
+  }
+
+ private:
+  void run(sycl::queue& queue, size_t size, bool aligned,
+           const std::string& name) {
+    const size_t width = size;
+    const size_t height = size;
+    const pitches p = get_pitches(width, aligned);
+    const size_t region_bytes = width * height * sizeof(pixel);
+
+    std::vector<pixel> result(p.dest * height);
+    auto src = allocate_memory<pixel, SrcPtrType>(p.src * height, queue);
+    auto dest = allocate_memory<pixel, DestPtrType>(result.size(), queue);
+    REQUIRE((src && dest));
+    pixel* src_ptr = src.get();
+    pixel* dest_ptr = dest.get();
+    {
+      std::vector<pixel> host_src(p.src * height);
+      for (size_t row = 0; row < height; ++row)
+        for (size_t col = 0; col < p.src; ++col)
+          host_src[row * p.src + col] = pattern(row, col);
+      upload<SrcPtrType>(src_ptr, host_src, queue);
+    }
+
+    const auto measure_and_verify = [&](const char* op, auto&& copy) {
+      fill_memory<pixel, DestPtrType>(dest_ptr, sentinel, result.size(),
+                                      queue);
+      const auto t = performance::measure(copy);
+      copy_destination_to_host_result<DestPtrType>(dest_ptr, result.data(),
+                                                   result.size(), queue);
+      verify_region(result, p.dest, width, height, pattern,
+                    std::string(op) + ", " + name);
+      return t;
+    };
+
+    const auto memcpy2d = measure_and_verify("memcpy2d", [&] {
+      queue
+          .ext_oneapi_memcpy2d(dest_ptr, p.dest * sizeof(pixel), src_ptr,
+                               p.src * sizeof(pixel), width * sizeof(pixel),
+                               height)
+          .wait_and_throw();
+    });
+    const auto copy2d = measure_and_verify("copy2d", [&] {
+      queue.ext_oneapi_copy2d(src_ptr, p.src, dest_ptr, p.dest, width, height)
+          .wait_and_throw();
+    });
+
+    performance::result res("oneapi_memcpy2d", "copy " + name);
+    res.with("memcpy2d", memcpy2d)
+        .with("memcpy2d bandwidth",
+              performance::bandwidth_gbs(region_bytes, memcpy2d),
+              "GB/s")
+        .with("copy2d", copy2d)
+        .with("copy2d bandwidth",
+              performance::bandwidth_gbs(region_bytes, copy2d), "GB/s");
+
+    if constexpr (kernel_accessible) {
+      const size_t sp = p.src;
+      const size_t dp = p.dest;
+      const auto kernel = measure_and_verify("parallel_for", [&] {
+        queue
+            .parallel_for(sycl::range<2>(height, width),
+                          [=](sycl::id<2> idx) {
+                            dest_ptr[idx[0] * dp + idx[1]] =
+                                src_ptr[idx[0] * sp + idx[1]];
+                          })
+            .wait_and_throw();
+      });
+      res.with("parallel_for", kernel)
+          .with("parallel_for bandwidth",
+                performance::bandwidth_gbs(region_bytes, kernel),
+                "GB/s");
+    }
+    res.record();
+  }
+};
+
+template <typename DestPtrT>
+class run_fill_scaling {
+  static constexpr pointer_type DestPtrType = DestPtrT::value;
+  static constexpr bool kernel_accessible = DestPtrType != pointer_type::host;
+
+ public:
+  void operator()(sycl::queue& queue, const std::string& dest_ptr_type_name) {
+    if (!check_device_aspect_allocations<DestPtrType>(queue)) {
+      SKIP("Device does not support the USM allocations. Skipping the test.");
+    }
+
+    for (const size_t size : region_sizes) {
+      if (!fits(queue, size)) {
+        WARN("Region of " << size << "x" << size
+                          << " exceeds the allocation limits, skipped");
+        continue;
+      }
+      for (const bool aligned : {true, false}) {
+        run(queue, size, aligned,
+            dest_ptr_type_name + ", " + std::to_string(size) + "x" +
+                std::to_string(size) +
+                (aligned ? ", aligned pitch" : ", unaligned pitch"));
+      }
+    }
+  }
+
+ private:
+  void run(sycl::queue& queue, size_t size, bool aligned,
+           const std::string& name) {
+    const size_t width = size;
+    const size_t height = size;
+    const size_t dp = get_pitches(width, aligned).dest;
+    const size_t region_bytes = width * height * sizeof(pixel);
+
+    std::vector<pixel> result(dp * height);
+    auto dest = allocate_memory<pixel, DestPtrType>(result.size(), queue);
+    REQUIRE(dest);
+    pixel* dest_ptr = dest.get();
+
+    const auto measure_and_verify = [&](const char* op, pixel expected,
+                                        auto&& fill) {
+      fill_memory<pixel, DestPtrType>(dest_ptr, sentinel, result.size(),
+                                      queue);
+      const auto t = performance::measure(fill);
+      copy_destination_to_host_result<DestPtrType>(dest_ptr, result.data(),
+                                                   result.size(), queue);
+      verify_region(
+          result, dp, width, height,
+          [=](size_t, size_t) { return expected; },
+          std::string(op) + ", " + name);
+      return t;
+    };
+
+    const pixel memset_pixel = memset_value * 0x01010101u;
+    const auto memset2d = measure_and_verify("memset2d", memset_pixel, [&] {
+      queue
+          .ext_oneapi_memset2d(dest_ptr, dp * sizeof(pixel), memset_value,
+                               width * sizeof(pixel), height)
+          .wait_and_throw();
+    });
+    const auto fill2d = measure_and_verify("fill2d", fill_pattern, [&] {
+      queue.ext_oneapi_fill2d(dest_ptr, dp, fill_pattern, width, height)
+          .wait_and_throw();
+    });
+
+    performance::result res("oneapi_memcpy2d", "fill " + name);
+    res.with("memset2d", memset2d)
+        .with("memset2d bandwidth",
+              performance::bandwidth_gbs(region_bytes, memset2d),
+              "GB/s")
+        .with("fill2d", fill2d)
+        .with("fill2d bandwidth",
+              performance::bandwidth_gbs(region_bytes, fill2d), "GB/s");
+
+    if constexpr (kernel_accessible) {
+      const auto kernel = measure_and_verify("parallel_for", fill_pattern, [&] {
+        queue
+            .parallel_for(sycl::range<2>(height, width),
+                          [=](sycl::id<2> idx) {
+                            dest_ptr[idx[0] * dp + idx[1]] = fill_pattern;
+                          })
+            .wait_and_throw();
+      });
+      res.with("parallel_for", kernel)
+          .with("parallel_for bandwidth",
+                performance::bandwidth_gbs(region_bytes, kernel),
+                "GB/s");
+    }
+    res.record();
+  }
+};
+
+#endif  // SYCL_EXT_ONEAPI_MEMCPY2D
+
+TEST_CASE("memcpy2d and copy2d bandwidth over image sized regions",
+          "[oneapi_memcpy2d][performance]") {
+#if !defined(SYCL_EXT_ONEAPI_MEMCPY2D)
+  SKIP("SYCL_EXT_ONEAPI_MEMCPY2D is not defined");
+#else
+  auto queue = util::get_cts_object::queue();
+  for_all_combinations<run_copy_scaling>(get_pointer_types(),
+                                         get_pointer_types(), queue);
+#endif
+}
+
+TEST_CASE("memset2d and fill2d bandwidth over image sized regions",
+          "[oneapi_memcpy2d][performance]") {
+#if !defined(SYCL_EXT_ONEAPI_MEMCPY2D)
+  SKIP("SYCL_EXT_ONEAPI_MEMCPY2D is not defined");
+#else
+  auto queue = util::get_cts_object::queue();
+  for_all_combinations<run_fill_scaling>(get_pointer_types(), queue);
+#endif
+}
+
+}  // namespace memcpy2d_scaling_perf
@@ -21,6 +21,7 @@
 #include <map>
 #include <valarray>
 
+#include "../../common/failure_recorder.h"
 #include "../../group_functions/group_functions_common.h"
 #include "non_uniform_group_common.h"
 
@@ -95,22 +96,13 @@ struct JointScanDataStruct {
                         init_value, op);
     std::inclusive_scan(ref_input.begin(), ref_input.end(), reference_i.begin(),
                         op, init_value);
+    sycl_cts::failure_recorder<U> failures;
     for (int i = 0; i < range_size; i++) {
-      {
-        INFO("Check joint_exclusive_scan on " + group_name + " for element " +
-             std::to_string(i) + " (Operator: " + op_name + ")");
-        INFO("Result: " + std::to_string(res[i]));
-        INFO("Expected: " + std::to_string(reference_e[i]));
-        CHECK(res[i] == reference_e[i]);
-      }
-      {
-        INFO("Check joint_inclusive_scan on " + group_name + " for element " +
-             std::to_string(i) + " (Operator: " + op_name + ")");
-        INFO("Result: " + std::to_string(res[i + range_size]));
-        INFO("Expected: " + std::to_string(reference_i[i]));
-        CHECK(res[i + range_size] == reference_i[i]);
-      }
+      failures.check_equal("joint_exclusive_scan", i, res[i], reference_e[i]);
+      failures.check_equal("joint_inclusive_scan", i, res[i + range_size],
+                           reference_i[i]);
     }
+    failures.report("Group: " + group_name + ", Operator: " + op_name);
   }
 
   sycl::buffer<T, 1> create_ref_input_buffer() {
@@ -360,6 +352,7 @@ struct ScanOverGroupDataStruct {
     CHECK(ret_type[1]);
 
     T init_value = with_init ? T(init) : sycl::known_identity<OpT, T>::value;
+    sycl_cts::failure_recorder<T> failures;
     {
       // Mapping from "sub-group id" and "non-uniform group id" to "vector of
       // input data (ordered by item linear id within the sub-group)"
@@ -395,27 +388,15 @@ struct ScanOverGroupDataStruct {
         std::vector<T> reference(lid + 1, T(-1));
         std::exclusive_scan(input_vec.begin(), input_vec.begin() + lid + 1,
                             reference.begin(), init_value, op);
-        {
-          int res_i = i;
-          INFO("Check exclusive_scan_over_group on " + group_name +
-               " for element " + std::to_string(i) + " (Operator: " + op_name +
-               ")");
-          INFO("Result: " + std::to_string(res[i]));
-          INFO("Expected: " + std::to_string(reference[lid]));
-          CHECK(res[i] == reference[lid]);
-        }
+        failures.check_equal("exclusive_scan_over_group", i, res[i],
+                             reference[lid]);
         std::inclusive_scan(input_vec.begin(), input_vec.begin() + lid + 1,
                             reference.begin(), op, init_value);
-        {
-          INFO("Check inclusive_scan_over_group on " + group_name +
-               " for element " + std::to_string(i) + " (Operator: " + op_name +
-               ")");
-          INFO("Result: " + std::to_string(res[range_size + i]));
-          INFO("Expected: " + std::to_string(reference[lid]));
-          CHECK(res[range_size + i] == reference[lid]);
-        }
+        failures.check_equal("inclusive_scan_over_group", i,
+                             res[range_size + i], reference[lid]);
       }
     }
+    failures.report("Group: " + group_name + ", Operator: " + op_name);
   }
 
   sycl::buffer<U, 1> create_ref_input_buffer() {
@@ -0,0 +1,59 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "non_uniform_group_stress.h"
+
+namespace non_uniform_groups::tests {
+using namespace non_uniform_groups::stress;
+
+// Large enough to spread over all compute units of common devices
+constexpr size_t stress_items = 1 << 20;
+constexpr uint32_t stress_seeds[] = {1, 42, 2024, 65537};
+
+template <typename GroupT>
+struct divergence_stress_test {
+  void operator()(sycl::queue& queue) {
+    const std::string group_name = NonUniformGroupHelper<GroupT>::get_name();
+
+    INFO("Testing randomized divergence for " + group_name);
+    if (!NonUniformGroupHelper<GroupT>::is_supported(queue.get_device())) {
+      SKIP("Device does not support " + group_name);
+    }
+
+    stress_run<GroupT> run(queue, stress_items);
+    for (const uint32_t seed : stress_seeds) {
+      const input in = make_input(run.size(), seed);
+      run.upload(in);
+      run.run();
+      verify_stress<GroupT>(in, run.download(),
+                            group_name + ", seed " + std::to_string(seed));
+    }
+  }
+};
+
+TEMPLATE_LIST_TEST_CASE(
+    "Non-uniform group collectives under randomized divergence",
+    "[oneapi_non_uniform_groups][group_func][type_list]", GroupPackTypes) {
+  auto queue = once_per_unit::get_queue();
+
+  for_all_combinations<divergence_stress_test>(TestType{}, queue);
+}
+
+}  // namespace non_uniform_groups::tests
@@ -0,0 +1,353 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Randomized divergence stress for non-uniform groups
+//
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "../../common/failure_recorder.h"
+#include "../../group_functions/group_functions_common.h"
+#include "non_uniform_group_common.h"
+
+namespace non_uniform_groups::stress {
+
+// Items are launched in work-groups of this size or of the maximum one,
+// whichever is smaller
+constexpr size_t preferred_work_group_size = 256;
+
+/**
+ * @brief What each work-item observed of its non-uniform group
+ */
+struct record {
+  // Sub-group index unique within the launch
+  uint32_t sub_group;
+  uint32_t sub_group_local_id;
+  uint32_t local_id;
+  uint32_t local_range;
+  // Global id of the group leader, broadcast from the leader
+  uint32_t leader;
+  uint32_t reduce;
+  uint32_t exclusive_scan;
+};
+
+// Values are salted differently in the two branches of a divergent group, so
+// that the compiler cannot merge the branches
+constexpr uint32_t salt_true = 0x9E3779B9;
+constexpr uint32_t salt_false = 0x7F4A7C15;
+
+inline uint32_t salted(uint32_t value, bool predicate) {
+  return value + (predicate ? salt_true : salt_false);
+}
+
+/**
+ * @brief Forms the non-uniform group of type GroupT for a work-item and calls
+ *        \p f with the group and the salt of the work-item's branch
+ * @details Items of a ballot_group are split by their predicate, tangle_group
+ *          and opportunistic_group are formed inside divergent branches on
+ *          the predicate, fixed_size_group ignores the predicate.
+ */
+template <typename GroupT>
+struct divergent_group;
+
+template <>
+struct divergent_group<oneapi_ext::ballot_group<sycl::sub_group>> {
+  // Items split into the same group have the same predicate
+  static constexpr bool by_predicate = true;
+  // All items with the same key form the group
+  static constexpr bool exact_membership = true;
+
+  template <typename FunctorT>
+  static void form(sycl::sub_group sg, bool predicate, FunctorT&& f) {
+    f(oneapi_ext::get_ballot_group(sg, predicate),
+      predicate ? salt_true : salt_false);
+  }
+};
+
+template <size_t PartitionSize>
+struct divergent_group<
+    oneapi_ext::fixed_size_group<PartitionSize, sycl::sub_group>> {
+  static constexpr bool by_predicate = false;
+  static constexpr bool exact_membership = true;
+  static constexpr size_t partition_size = PartitionSize;
+
+  template <typename FunctorT>
+  static void form(sycl::sub_group sg, bool predicate, FunctorT&& f) {
+    f(oneapi_ext::get_fixed_size_group<PartitionSize>(sg),
+      predicate ? salt_true : salt_false);
+  }
+};
+
+template <>
+struct divergent_group<oneapi_ext::tangle_group<sycl::sub_group>> {
+  static constexpr bool by_predicate = true;
+  static constexpr bool exact_membership = true;
+
+  template <typename FunctorT>
+  static void form(sycl::sub_group sg, bool predicate, FunctorT&& f) {
+    if (predicate) {
+      f(oneapi_ext::get_tangle_group(sg), salt_true);
+    } else {
+      f(oneapi_ext::get_tangle_group(sg), salt_false);
+    }
+  }
+};
+
+template <>
+struct divergent_group<oneapi_ext::opportunistic_group> {
+  static constexpr bool by_predicate = true;
+  // Any subset of the items in the branch may form a group
+  static constexpr bool exact_membership = false;
+
+  template <typename FunctorT>
+  static void form(sycl::sub_group, bool predicate, FunctorT&& f) {
+    if (predicate) {
+      f(oneapi_ext::this_kernel::get_opportunistic_group(), salt_true);
+    } else {
+      f(oneapi_ext::this_kernel::get_opportunistic_group(), salt_false);
+    }
+  }
+};
+
+/**
+ * @brief Randomized input of a single stress run
+ */
+struct input {
+  std::vector<uint8_t> predicates;
+  std::vector<uint32_t> values;
+};
+
+/**
+ * @brief Generates predicates with a density picked at random for each block
+ *        of 32 work-items, so that sub-groups see anything from no divergence
+ *        to a single item on one side
+ */
+inline input make_input(size_t count, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<uint32_t> values;
+  std::uniform_int_distribution<int> densities(0, 8);
+  std::uniform_int_distribution<int> eighths(0, 7);
+
+  input in{std::vector<uint8_t>(count), std::vector<uint32_t>(count)};
+  int density = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (i % 32 == 0) density = densities(gen);
+    in.predicates[i] = eighths(gen) < density;
+    in.values[i] = values(gen);
+  }
+  return in;
+}
+
+template <typename GroupT>
+class stress_kernel;
+
+/**
+ * @brief Returns the nd_range used for \p count work-items on \p queue
+ */
+inline sycl::nd_range<1> stress_range(sycl::queue& queue, size_t count) {
+  const size_t max_wg_size =
+      queue.get_device().get_info<sycl::info::device::max_work_group_size>();
+  const size_t local = std::min(preferred_work_group_size, max_wg_size);
+  const size_t global = (count + local - 1) / local * local;
+  return {sycl::range<1>(global), sycl::range<1>(local)};
+}
+
+/**
+ * @brief Runs broadcast, reduce and exclusive scan over the groups formed on
+ *        the given predicates and writes the records of all work-items
+ * @details All pointers are USM device allocations with one element per
+ *          work-item of \p range.
+ */
+template <typename GroupT>
+sycl::event submit_stress(sycl::queue& queue, sycl::nd_range<1> range,
+                          const uint8_t* predicates, const uint32_t* values,
+                          record* records) {
+  return queue.parallel_for<stress_kernel<GroupT>>(
+      range, [=](sycl::nd_item<1> item) {
+        const size_t gid = item.get_global_linear_id();
+        sycl::sub_group sg = item.get_sub_group();
+        record& r = records[gid];
+        r.sub_group = static_cast<uint32_t>(
+            item.get_group_linear_id() * sg.get_group_linear_range() +
+            sg.get_group_linear_id());
+        r.sub_group_local_id = sg.get_local_linear_id();
+
+        const bool predicate = predicates[gid];
+        divergent_group<GroupT>::form(
+            sg, predicate, [&](auto group, uint32_t salt) {
+              const uint32_t value = values[gid] + salt;
+              r.local_id = group.get_local_linear_id();
+              r.local_range = group.get_local_linear_range();
+              r.leader =
+                  sycl::group_broadcast(group, static_cast<uint32_t>(gid));
+              r.reduce =
+                  sycl::reduce_over_group(group, value, sycl::plus<uint32_t>());
+              r.exclusive_scan = sycl::exclusive_scan_over_group(
+                  group, value, sycl::plus<uint32_t>());
+            });
+      });
+}
+
+/**
+ * @brief Verifies \p records against a host model of group membership
+ * @details Groups are reconstructed from the broadcast leader ids. Every
+ *          group has to be non-empty, consist of items of a single sub-group
+ *          and partition key, agree on its size and use distinct local ids.
+ *          For all groups but opportunistic_group it has to contain exactly
+ *          the items of its key, ordered by their sub-group local id. Reduce
+ *          and scan results are compared with sums over the members.
+ */
+template <typename GroupT>
+void verify_stress(const input& in, const std::vector<record>& records,
+                   const std::string& context) {
+  using traits = divergent_group<GroupT>;
+  sycl_cts::failure_recorder<uint32_t> failures;
+
+  const auto key_of = [&](size_t i) -> uint32_t {
+    if constexpr (traits::by_predicate)
+      return in.predicates[i];
+    else
+      return records[i].sub_group_local_id / traits::partition_size;
+  };
+
+  // Members of each group by leader id, and the items of each partition key
+  std::map<uint32_t, std::vector<size_t>> groups;
+  std::map<std::pair<uint32_t, uint32_t>, size_t> key_sizes;
+  for (size_t i = 0; i < records.size(); ++i) {
+    groups[records[i].leader].push_back(i);
+    ++key_sizes[{records[i].sub_group, key_of(i)}];
+  }
+
+  for (auto& [leader, members] : groups) {
+    if (!failures.check(leader < records.size(), "leader is a work-item",
+                        members.front(), leader, 0))
+      continue;
+    const record& head = records[leader];
+    failures.check(head.local_id == 0, "local id of the leader", leader,
+                   head.local_id, 0);
+
+    std::sort(members.begin(), members.end(), [&](size_t a, size_t b) {
+      return records[a].sub_group_local_id < records[b].sub_group_local_id;
+    });
+    std::vector<uint8_t> seen(members.size(), 0);
+    uint32_t reduce = 0;
+    for (const size_t i : members)
+      reduce += salted(in.values[i], in.predicates[i]);
+
+    uint32_t rank = 0;
+    for (const size_t i : members) {
+      const record& r = records[i];
+      failures.check_equal("sub-group of a member", i, r.sub_group,
+                           head.sub_group);
+      failures.check_equal("partition key of a member", i, key_of(i),
+                           key_of(leader));
+      failures.check_equal("local range", i, r.local_range,
+                           static_cast<uint32_t>(members.size()));
+      if (failures.check(r.local_id < members.size(), "local id in range", i,
+                         r.local_id, static_cast<uint32_t>(members.size()))) {
+        failures.check(!seen[r.local_id], "local id is unique", i, r.local_id,
+                       r.local_id);
+        seen[r.local_id] = 1;
+      }
+      if (traits::exact_membership)
+        failures.check_equal("local id is the rank in the sub-group", i,
+                             r.local_id, rank);
+      failures.check_equal("reduce_over_group", i, r.reduce, reduce);
+      ++rank;
+    }
+
+    // The exclusive scan follows the order of the local ids
+    std::vector<size_t> by_local_id(members.size(), records.size());
+    for (const size_t i : members)
+      if (records[i].local_id < members.size())
+        by_local_id[records[i].local_id] = i;
+    uint32_t prefix = 0;
+    for (const size_t i : by_local_id) {
+      if (i == records.size()) break;
+      failures.check_equal("exclusive_scan_over_group", i,
+                           records[i].exclusive_scan, prefix);
+      prefix += salted(in.values[i], in.predicates[i]);
+    }
+
+    if (traits::exact_membership)
+      failures.check_equal(
+          "group size equals the items of its partition key", leader,
+          static_cast<uint32_t>(members.size()),
+          static_cast<uint32_t>(key_sizes[{head.sub_group, key_of(leader)}]));
+  }
+  failures.report(context);
+}
+
+/**
+ * @brief Launch of the stress kernel for a given number of work-items, with
+ *        the device memory kept across runs
+ */
+template <typename GroupT>
+class stress_run {
+ public:
+  stress_run(sycl::queue& queue, size_t count)
+      : m_queue(queue), m_range(stress_range(queue, count)) {
+    const size_t n = m_range.get_global_range().size();
+    m_predicates = sycl::malloc_device<uint8_t>(n, queue);
+    m_values = sycl::malloc_device<uint32_t>(n, queue);
+    m_records = sycl::malloc_device<record>(n, queue);
+    REQUIRE((m_predicates && m_values && m_records));
+  }
+
+  ~stress_run() {
+    sycl::free(m_predicates, m_queue);
+    sycl::free(m_values, m_queue);
+    sycl::free(m_records, m_queue);
+  }
+
+  stress_run(const stress_run&) = delete;
+  stress_run& operator=(const stress_run&) = delete;
+
+  size_t size() const { return m_range.get_global_range().size(); }
+
+  void upload(const input& in) {
+    m_queue.copy(in.predicates.data(), m_predicates, size());
+    m_queue.copy(in.values.data(), m_values, size());
+    m_queue.wait_and_throw();
+  }
+
+  void run() {
+    submit_stress<GroupT>(m_queue, m_range, m_predicates, m_values, m_records)
+        .wait_and_throw();
+  }
+
+  std::vector<record> download() {
+    std::vector<record> records(size());
+    m_queue.copy(m_records, records.data(), size()).wait_and_throw();
+    return records;
+  }
+
+ private:
+  sycl::queue& m_queue;
+  sycl::nd_range<1> m_range;
+  uint8_t* m_predicates = nullptr;
+  uint32_t* m_values = nullptr;
+  record* m_records = nullptr;
+};
+
+}  // namespace non_uniform_groups::stress
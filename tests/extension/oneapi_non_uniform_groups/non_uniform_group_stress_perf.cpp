@@ -0,0 +1,63 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../../common/performance.h"
+#include "non_uniform_group_stress.h"
+
+namespace non_uniform_groups::tests {
+using namespace non_uniform_groups::stress;
+using namespace sycl_cts;
+
+constexpr size_t throughput_items = 1 << 22;
+
+template <typename GroupT>
+struct divergence_throughput_test {
+  void operator()(sycl::queue& queue) {
+    const std::string group_name = NonUniformGroupHelper<GroupT>::get_name();
+
+    if (!NonUniformGroupHelper<GroupT>::is_supported(queue.get_device())) {
+      SKIP("Device does not support " + group_name);
+    }
+
+    stress_run<GroupT> run(queue, throughput_items);
+    const input in = make_input(run.size(), 1);
+    run.upload(in);
+
+    const auto t = performance::measure([&] { run.run(); });
+    verify_stress<GroupT>(in, run.download(), group_name);
+
+    // Each work-item forms its group and runs three collectives on it
+    const double items_per_us = t.median > 0 ? run.size() / t.median : 0;
+    performance::result("oneapi_non_uniform_groups", group_name)
+        .with("kernel", t)
+        .with("throughput", items_per_us, "Mitems/s")
+        .record();
+  }
+};
+
+TEMPLATE_LIST_TEST_CASE(
+    "Non-uniform group collective throughput under divergence",
+    "[oneapi_non_uniform_groups][performance]", GroupPackTypes) {
+  auto queue = once_per_unit::get_queue();
+
+  for_all_combinations<divergence_throughput_test>(TestType{}, queue);
+}
+
+}  // namespace non_uniform_groups::tests
@@ -19,6 +19,7 @@
 *******************************************************************************/
 
 #include "../../common/common.h"
+#include "root_group_exchange.h"
 
 namespace root_group::tests {
 
@@ -241,4 +242,27 @@ TEST_CASE(
 #endif
 }
 
+TEST_CASE(
+    "Test for \"Root Group\" extension, check that no work-group passes a "
+    "root_group barrier early when exchanging data",
+    "[oneapi_root_group_barrier]") {
+#ifndef SYCL_EXT_ONEAPI_ROOT_GROUP
+  SKIP("SYCL_EXT_ONEAPI_ROOT_GROUP is not defined");
+#else
+  using namespace root_group::exchange;
+  constexpr uint32_t rounds = 64;
+
+  auto q = sycl_cts::util::get_cts_object::queue();
+  const size_t local = local_size(q);
+  const size_t max_groups = max_work_groups<struct RootGroupExchange>(q, local);
+  REQUIRE(max_groups >= 1);
+
+  exchange_state<struct RootGroupExchange> state(q, max_groups);
+  for (const size_t groups : {size_t{1}, (max_groups + 1) / 2, max_groups}) {
+    state.run(groups, local, rounds);
+    verify_exchange(state, groups, rounds);
+  }
+#endif
+}
+
 }  // namespace root_group::tests
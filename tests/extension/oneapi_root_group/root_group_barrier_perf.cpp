@@ -0,0 +1,73 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../../common/common.h"
+#include "../../common/performance.h"
+#include "root_group_exchange.h"
+
+#include <vector>
+
+namespace root_group::tests {
+
+TEST_CASE("root_group barrier latency by number of work-groups",
+          "[oneapi_root_group_barrier][performance]") {
+#ifndef SYCL_EXT_ONEAPI_ROOT_GROUP
+  SKIP("SYCL_EXT_ONEAPI_ROOT_GROUP is not defined");
+#else
+  using namespace root_group::exchange;
+  using namespace sycl_cts;
+  using kernel_name = struct RootGroupExchangePerf;
+  // Two barriers per round
+  constexpr uint32_t rounds = 1000;
+  constexpr uint32_t barriers = 2 * rounds;
+
+  auto q = util::get_cts_object::queue();
+  const size_t local = local_size(q);
+  const size_t max_groups = max_work_groups<kernel_name>(q, local);
+  REQUIRE(max_groups >= 1);
+
+  std::vector<size_t> group_counts;
+  for (size_t groups = 1; groups < max_groups; groups *= 2)
+    group_counts.push_back(groups);
+  group_counts.push_back(max_groups);
+
+  exchange_state<kernel_name> state(q, max_groups);
+  for (const size_t groups : group_counts) {
+    // The launch without rounds is subtracted to get the barrier cost only
+    const auto launch =
+        performance::measure([&] { state.run(groups, local, 0); });
+    const auto exchange =
+        performance::measure([&] { state.run(groups, local, rounds); });
+    verify_exchange(state, groups, rounds);
+
+    const double per_barrier =
+        std::max(exchange.median - launch.median, 0.0) / barriers;
+    performance::result("oneapi_root_group",
+                        std::to_string(groups) + " work-groups of " +
+                            std::to_string(local))
+        .with("launch", launch)
+        .with("exchange", exchange)
+        .with("barrier latency", per_barrier, "us")
+        .record();
+  }
+#endif
+}
+
+}  // namespace root_group::tests
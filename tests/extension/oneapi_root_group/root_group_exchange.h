@@ -0,0 +1,175 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Repeated root_group barriers with data exchange between work-groups
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_ONEAPI_ROOT_GROUP_EXCHANGE_H
+#define __SYCLCTS_TESTS_ONEAPI_ROOT_GROUP_EXCHANGE_H
+
+#include "../../common/common.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#ifdef SYCL_EXT_ONEAPI_ROOT_GROUP
+
+namespace root_group::exchange {
+namespace oneapi_ext = sycl::ext::oneapi::experimental;
+
+/**
+ * @brief Returns the work-group size used for the exchange on \p q
+ */
+inline size_t local_size(sycl::queue& q) {
+  const size_t max_wg_size =
+      q.get_device().get_info<sycl::info::device::max_work_group_size>();
+  return std::min<size_t>(128, max_wg_size);
+}
+
+/**
+ * @brief Returns the maximum number of work-groups of \p local items that can
+ *        be launched together with the exchange kernel
+ * @tparam KernelName Name of the exchange kernel, unique per translation unit
+ */
+template <typename KernelName>
+size_t max_work_groups(sycl::queue& q, size_t local) {
+  auto bundle =
+      sycl::get_kernel_bundle<sycl::bundle_state::executable>(q.get_context());
+  auto kernel = bundle.get_kernel<KernelName>();
+  return kernel.ext_oneapi_get_info<
+      oneapi_ext::info::kernel_queue_specific::max_num_work_groups>(
+      q, sycl::range<1>(local), 0);
+}
+
+/**
+ * @brief Runs \p rounds of a root_group barrier exchange over \p groups
+ *        work-groups
+ * @details In every round the leader of each work-group publishes the round
+ *          number in its slot, all work-items pass a root_group barrier and
+ *          read the slot of the next work-group, then pass a second barrier
+ *          before the slots are overwritten. A work-group racing ahead of the
+ *          barrier would publish the next round early, one falling behind
+ *          would leave the previous round, and both show up as a mismatch.
+ * @param slots USM allocation with one element per work-group, holds the
+ *              last published round afterwards
+ * @param mismatches USM counter of reads which observed a wrong round, has to
+ *                   be zero initialized
+ */
+template <typename KernelName>
+sycl::event submit_exchange(sycl::queue& q, size_t groups, size_t local,
+                            uint32_t rounds, uint32_t* slots,
+                            uint32_t* mismatches) {
+  const sycl::nd_range<1> range{sycl::range<1>(groups * local),
+                                sycl::range<1>(local)};
+  const auto props = oneapi_ext::properties{oneapi_ext::use_root_sync};
+  return q.parallel_for<KernelName>(
+      range, props, [=](sycl::nd_item<1> it) {
+        auto root = it.ext_oneapi_get_root_group();
+        const size_t group = it.get_group_linear_id();
+        const size_t next = (group + 1) % groups;
+        const bool leader = it.get_local_linear_id() == 0;
+
+        uint32_t observed_wrong = 0;
+        for (uint32_t round = 1; round <= rounds; ++round) {
+          if (leader) slots[group] = round;
+          sycl::group_barrier(root);
+          observed_wrong += slots[next] != round;
+          sycl::group_barrier(root);
+        }
+        if (observed_wrong != 0) {
+          sycl::atomic_ref<uint32_t, sycl::memory_order::relaxed,
+                           sycl::memory_scope::device>
+              counter(*mismatches);
+          counter += observed_wrong;
+        }
+      });
+}
+
+/**
+ * @brief Device memory of an exchange over up to \p max_groups work-groups
+ */
+template <typename KernelName>
+class exchange_state {
+ public:
+  exchange_state(sycl::queue& q, size_t max_groups)
+      : m_queue(q), m_max_groups(max_groups) {
+    m_slots = sycl::malloc_device<uint32_t>(max_groups, q);
+    m_mismatches = sycl::malloc_device<uint32_t>(1, q);
+    REQUIRE((m_slots && m_mismatches));
+  }
+
+  ~exchange_state() {
+    sycl::free(m_slots, m_queue);
+    sycl::free(m_mismatches, m_queue);
+  }
+
+  exchange_state(const exchange_state&) = delete;
+  exchange_state& operator=(const exchange_state&) = delete;
+
+  /**
+   * @brief Runs the exchange and waits for it to complete
+   */
+  void run(size_t groups, size_t local, uint32_t rounds) {
+    m_queue.fill(m_slots, uint32_t{0}, m_max_groups);
+    m_queue.fill(m_mismatches, uint32_t{0}, 1);
+    m_queue.wait_and_throw();
+    submit_exchange<KernelName>(m_queue, groups, local, rounds, m_slots,
+                                m_mismatches)
+        .wait_and_throw();
+  }
+
+  uint32_t mismatches() {
+    uint32_t result = 0;
+    m_queue.copy(m_mismatches, &result, 1).wait_and_throw();
+    return result;
+  }
+
+  std::vector<uint32_t> slots(size_t groups) {
+    std::vector<uint32_t> result(groups);
+    m_queue.copy(m_slots, result.data(), groups).wait_and_throw();
+    return result;
+  }
+
+ private:
+  sycl::queue& m_queue;
+  size_t m_max_groups;
+  uint32_t* m_slots = nullptr;
+  uint32_t* m_mismatches = nullptr;
+};
+
+/**
+ * @brief Checks that no work-group observed a wrong round and all of them
+ *        completed every round
+ */
+template <typename KernelName>
+void verify_exchange(exchange_state<KernelName>& state, size_t groups,
+                     uint32_t rounds) {
+  INFO("work-groups: " << groups << ", rounds: " << rounds);
+  CHECK(state.mismatches() == 0);
+  const std::vector<uint32_t> slots = state.slots(groups);
+  CHECK(std::all_of(slots.begin(), slots.end(),
+                    [=](uint32_t s) { return s == rounds; }));
+}
+
+}  // namespace root_group::exchange
+
+#endif  // SYCL_EXT_ONEAPI_ROOT_GROUP
+
+#endif  // __SYCLCTS_TESTS_ONEAPI_ROOT_GROUP_EXCHANGE_H
@@ -20,6 +20,7 @@
 
 #include <valarray>
 
+#include "../common/failure_recorder.h"
 #include "group_functions_common.h"
 
 template <int D, typename T, typename U, typename I, typename OpT>
@@ -97,28 +98,24 @@ struct JointScanDataStruct {
                         op, init_value);
     // res consists of 4 series of results: two pairs of exclusive and inclusive
     // scan results made over 'group' and 'sub_group' accordingly.
+    sycl_cts::failure_recorder<U> failures;
     for (int group_i = 0; group_i < 2; group_i++) {
-      std::string group_name = group_i == 0 ? "group" : "sub_group";
+      const char* exclusive_name = group_i == 0
+                                       ? "joint_exclusive_scan on group"
+                                       : "joint_exclusive_scan on sub_group";
+      const char* inclusive_name = group_i == 0
+                                       ? "joint_inclusive_scan on group"
+                                       : "joint_inclusive_scan on sub_group";
       size_t group_offset = range_size * group_i;
       for (int i = 0; i < range_size; i++) {
         // Each group contains two sets of results.
         size_t res_i = i + 2 * group_offset;
-        {
-          INFO("Check joint_exclusive_scan on " + group_name + " for element " +
-               std::to_string(i) + " (Operator: " + op_name + ")");
-          INFO("Result: " + std::to_string(res[res_i]));
-          INFO("Expected: " + std::to_string(reference_e[i]));
-          CHECK(res[res_i] == reference_e[i]);
-        }
-        {
-          INFO("Check joint_inclusive_scan on " + group_name + " for element " +
-               std::to_string(i) + " (Operator: " + op_name + ")");
-          INFO("Result: " + std::to_string(res[res_i + range_size]));
-          INFO("Expected: " + std::to_string(reference_i[i]));
-          CHECK(res[res_i + range_size] == reference_i[i]);
-        }
+        failures.check_equal(exclusive_name, i, res[res_i], reference_e[i]);
+        failures.check_equal(inclusive_name, i, res[res_i + range_size],
+                             reference_i[i]);
       }
     }
+    failures.report("Operator: " + op_name);
   }
 
   sycl::buffer<T, 1> create_ref_input_buffer() {
@@ -350,6 +347,7 @@ struct ScanOverGroupDataStruct {
     CHECK(ret_type[3]);
 
     T init_value = with_init ? T(init) : sycl::known_identity<OpT, T>::value;
+    sycl_cts::failure_recorder<T> failures;
     // res consists of 4 series of results: two pairs of exclusive and inclusive
     // scan results made over 'group' and 'sub_group' accordingly.
     {
@@ -359,21 +357,15 @@ struct ScanOverGroupDataStruct {
                           init_value, op);
       for (int i = 0; i < range_size; i++) {
         int res_i = i;
-        INFO("Check exclusive_scan_over_group on group for element " +
-             std::to_string(i) + " (Operator: " + op_name + ")");
-        INFO("Result: " + std::to_string(res[res_i]));
-        INFO("Expected: " + std::to_string(reference[i]));
-        CHECK(res[res_i] == reference[i]);
+        failures.check_equal("exclusive_scan_over_group on group", i,
+                             res[res_i], reference[i]);
       }
       std::inclusive_scan(ref_input.begin(), ref_input.end(), reference.begin(),
                           op, init_value);
       for (int i = 0; i < range_size; i++) {
         int res_i = range_size + i;
-        INFO("Check inclusive_scan_over_group on group for element " +
-             std::to_string(i) + " (Operator: " + op_name + ")");
-        INFO("Result: " + std::to_string(res[res_i]));
-        INFO("Expected: " + std::to_string(reference[i]));
-        CHECK(res[res_i] == reference[i]);
+        failures.check_equal("inclusive_scan_over_group on group", i,
+                             res[res_i], reference[i]);
       }
     }
     {
@@ -399,26 +391,15 @@ struct ScanOverGroupDataStruct {
         std::vector<T> reference(lid + 1, T(-1));
         std::exclusive_scan(input_vec.begin(), input_vec.begin() + lid + 1,
                             reference.begin(), init_value, op);
-        {
-          int res_i = range_size * 2 + i;
-          INFO("Check exclusive_scan_over_group on sub_group for element " +
-               std::to_string(i) + " (Operator: " + op_name + ")");
-          INFO("Result: " + std::to_string(res[res_i]));
-          INFO("Expected: " + std::to_string(reference[lid]));
-          CHECK(res[res_i] == reference[lid]);
-        }
+        failures.check_equal("exclusive_scan_over_group on sub_group", i,
+                             res[range_size * 2 + i], reference[lid]);
         std::inclusive_scan(input_vec.begin(), input_vec.begin() + lid + 1,
                             reference.begin(), op, init_value);
-        {
-          int res_i = range_size * 3 + i;
-          INFO("Check inclusive_scan_over_group on sub_group for element " +
-               std::to_string(i) + " (Operator: " + op_name + ")");
-          INFO("Result: " + std::to_string(res[res_i]));
-          INFO("Expected: " + std::to_string(reference[lid]));
-          CHECK(res[res_i] == reference[lid]);
-        }
+        failures.check_equal("inclusive_scan_over_group on sub_group", i,
+                             res[range_size * 3 + i], reference[lid]);
       }
     }
+    failures.report("Operator: " + op_name);
   }
 
   sycl::buffer<U, 1> create_ref_input_buffer() {
@@ -0,0 +1,212 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Compares hierarchical kernels using private_memory and implicit barriers
+//  with equivalent nd_range kernels over large ranges
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+#include "../common/failure_recorder.h"
+#include "../common/performance.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hierarchical_scaling_perf {
+using namespace sycl_cts;
+
+constexpr size_t group_counts[] = {64, 1024, 16384};
+
+template <size_t LocalSize>
+class hierarchical_kernel;
+template <size_t LocalSize>
+class nd_range_kernel;
+
+inline uint32_t transform(uint32_t value) { return value * 3 + 1; }
+
+/**
+ * @brief Host model of both kernels
+ * @details Every work-item transforms its input, publishes it to the
+ *          work-group and adds the value of its right neighbour in the group.
+ *          The first work-item also stores the sum of the group.
+ */
+struct reference {
+  std::vector<uint32_t> out;
+  std::vector<uint32_t> sums;
+};
+
+inline reference make_reference(const std::vector<uint32_t>& in,
+                                size_t local_size) {
+  const size_t groups = in.size() / local_size;
+  reference ref{std::vector<uint32_t>(in.size()),
+                std::vector<uint32_t>(groups, 0)};
+  for (size_t g = 0; g < groups; ++g) {
+    const size_t base = g * local_size;
+    for (size_t l = 0; l < local_size; ++l) {
+      const uint32_t own = transform(in[base + l]);
+      ref.out[base + l] = own + transform(in[base + (l + 1) % local_size]);
+      ref.sums[g] += own;
+    }
+  }
+  return ref;
+}
+
+/**
+ * @brief Runs the workload with parallel_for_work_group, keeping the
+ *        transformed value in private_memory across two
+ *        parallel_for_work_item calls separated by an implicit barrier
+ */
+template <size_t LocalSize>
+sycl::event submit_hierarchical(sycl::queue& queue, size_t groups,
+                                const uint32_t* in, uint32_t* out,
+                                uint32_t* sums) {
+  return queue.submit([&](sycl::handler& cgh) {
+    cgh.parallel_for_work_group<hierarchical_kernel<LocalSize>>(
+        sycl::range<1>(groups), sycl::range<1>(LocalSize),
+        [=](sycl::group<1> group) {
+          uint32_t tile[LocalSize];
+          sycl::private_memory<uint32_t> own(group);
+
+          group.parallel_for_work_item([&](sycl::h_item<1> item) {
+            const size_t local_id = item.get_local_id(0);
+            own(item) = transform(in[item.get_global_id(0)]);
+            tile[local_id] = own(item);
+          });
+          group.parallel_for_work_item([&](sycl::h_item<1> item) {
+            const size_t local_id = item.get_local_id(0);
+            out[item.get_global_id(0)] =
+                own(item) + tile[(local_id + 1) % LocalSize];
+          });
+
+          uint32_t sum = 0;
+          for (size_t i = 0; i < LocalSize; ++i) sum += tile[i];
+          sums[group.get_group_id(0)] = sum;
+        });
+  });
+}
+
+/**
+ * @brief Runs the same workload as submit_hierarchical() with an nd_range
+ *        kernel, a local_accessor and explicit barriers
+ */
+template <size_t LocalSize>
+sycl::event submit_nd_range(sycl::queue& queue, size_t groups,
+                            const uint32_t* in, uint32_t* out,
+                            uint32_t* sums) {
+  return queue.submit([&](sycl::handler& cgh) {
+    sycl::local_accessor<uint32_t, 1> tile(sycl::range<1>(LocalSize), cgh);
+    cgh.parallel_for<nd_range_kernel<LocalSize>>(
+        sycl::nd_range<1>(sycl::range<1>(groups * LocalSize),
+                          sycl::range<1>(LocalSize)),
+        [=](sycl::nd_item<1> item) {
+          const size_t local_id = item.get_local_id(0);
+          const uint32_t own = transform(in[item.get_global_id(0)]);
+          tile[local_id] = own;
+          sycl::group_barrier(item.get_group());
+          out[item.get_global_id(0)] =
+              own + tile[(local_id + 1) % LocalSize];
+
+          if (local_id == 0) {
+            uint32_t sum = 0;
+            for (size_t i = 0; i < LocalSize; ++i) sum += tile[i];
+            sums[item.get_group_linear_id()] = sum;
+          }
+        });
+  });
+}
+
+void verify(sycl::queue& queue, const reference& ref, const uint32_t* out,
+            const uint32_t* sums, const std::string& context) {
+  std::vector<uint32_t> host_out(ref.out.size());
+  std::vector<uint32_t> host_sums(ref.sums.size());
+  queue.copy(out, host_out.data(), host_out.size());
+  queue.copy(sums, host_sums.data(), host_sums.size());
+  queue.wait_and_throw();
+
+  failure_recorder<uint32_t> failures;
+  for (size_t i = 0; i < host_out.size(); ++i)
+    failures.check_equal("work-item result", i, host_out[i], ref.out[i]);
+  for (size_t g = 0; g < host_sums.size(); ++g)
+    failures.check_equal("work-group sum", g, host_sums[g], ref.sums[g]);
+  failures.report(context);
+}
+
+template <size_t LocalSize>
+void run_scaling(sycl::queue& queue) {
+  const size_t max_wg_size =
+      queue.get_device().get_info<sycl::info::device::max_work_group_size>();
+  if (LocalSize > max_wg_size) {
+    WARN("Work-group size " << LocalSize << " is not supported, skipped");
+    return;
+  }
+
+  for (const size_t groups : group_counts) {
+    const size_t items = groups * LocalSize;
+    const std::string name = std::to_string(groups) + " work-groups of " +
+                             std::to_string(LocalSize);
+
+    std::vector<uint32_t> host_in(items);
+    for (size_t i = 0; i < items; ++i)
+      host_in[i] = static_cast<uint32_t>(i * 2654435761u);
+    const reference ref = make_reference(host_in, LocalSize);
+
+    uint32_t* in = sycl::malloc_device<uint32_t>(items, queue);
+    uint32_t* out = sycl::malloc_device<uint32_t>(items, queue);
+    uint32_t* sums = sycl::malloc_device<uint32_t>(groups, queue);
+    REQUIRE((in && out && sums));
+    queue.copy(host_in.data(), in, items).wait_and_throw();
+
+    const auto hierarchical = performance::measure([&] {
+      submit_hierarchical<LocalSize>(queue, groups, in, out, sums)
+          .wait_and_throw();
+    });
+    verify(queue, ref, out, sums, "hierarchical, " + name);
+
+    queue.fill(out, uint32_t{0}, items);
+    queue.fill(sums, uint32_t{0}, groups);
+    queue.wait_and_throw();
+    const auto nd_range = performance::measure([&] {
+      submit_nd_range<LocalSize>(queue, groups, in, out, sums)
+          .wait_and_throw();
+    });
+    verify(queue, ref, out, sums, "nd_range, " + name);
+
+    sycl::free(in, queue);
+    sycl::free(out, queue);
+    sycl::free(sums, queue);
+
+    performance::result("hierarchical", name)
+        .with("parallel_for_work_group", hierarchical)
+        .with("nd_range", nd_range)
+        .with("slowdown",
+              nd_range.median > 0 ? hierarchical.median / nd_range.median : 0,
+              "x")
+        .record();
+  }
+}
+
+TEST_CASE("Hierarchical parallelism scaling compared to nd_range",
+          "[hierarchical][performance]") {
+  auto queue = util::get_cts_object::queue();
+  run_scaling<64>(queue);
+  run_scaling<256>(queue);
+}
+
+}  // namespace hierarchical_scaling_perf
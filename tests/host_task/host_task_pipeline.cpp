@@ -0,0 +1,56 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "host_task_pipeline.h"
+
+namespace host_task_pipeline::tests {
+
+constexpr size_t long_pipeline_stages = 10000;
+
+TEST_CASE("Long device_task / host_task pipeline over buffers",
+          "[host_task]") {
+  auto queue = sycl_cts::util::get_cts_object::queue();
+  const pipeline_result result =
+      run_buffer_pipeline(queue, long_pipeline_stages);
+  verify_pipeline(result, long_pipeline_stages, "buffers");
+}
+
+TEST_CASE(
+    "Long device_task / host_task pipeline over USM with interop_handle",
+    "[host_task]") {
+  auto default_queue = sycl_cts::util::get_cts_object::queue();
+  sycl::queue queue{default_queue.get_context(), default_queue.get_device(),
+                    sycl::property::queue::in_order{}};
+  const auto device = queue.get_device();
+  if (!device.has(sycl::aspect::usm_shared_allocations) &&
+      !device.has(sycl::aspect::usm_host_allocations)) {
+    SKIP("Device does not support host accessible USM allocations.");
+  }
+
+  usm_pipeline_memory memory(queue, long_pipeline_stages);
+  submit_usm_pipeline(queue, long_pipeline_stages, memory.data, memory.tags,
+                      memory.mismatches);
+  queue.wait_and_throw();
+
+  CHECK(*memory.mismatches == 0);
+  verify_pipeline(memory.result(), long_pipeline_stages, "USM");
+}
+
+}  // namespace host_task_pipeline::tests
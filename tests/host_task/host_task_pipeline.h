@@ -0,0 +1,212 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Long alternating device / host_task pipelines over buffers and USM
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_HOST_TASK_PIPELINE_H
+#define __SYCLCTS_TESTS_HOST_TASK_PIPELINE_H
+
+#include "../common/common.h"
+#include "../common/failure_recorder.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace host_task_pipeline {
+
+// Number of data elements each stage transforms
+constexpr size_t data_size = 64;
+constexpr uint32_t init_value = 7;
+
+/**
+ * @brief Transformation of a device stage, which together with host_stage()
+ *        makes the final data depend on the order of all stages
+ */
+inline uint32_t device_stage(uint32_t value, uint32_t stage) {
+  return value * 3 + stage;
+}
+
+inline uint32_t host_stage(uint32_t value, uint32_t stage) {
+  return value ^ (stage * 0x9E3779B9u);
+}
+
+inline bool is_host_stage(size_t stage) { return stage % 2 == 1; }
+
+/**
+ * @brief Results of a pipeline run
+ * @details Each stage writes the tag of the previous stage plus one into its
+ *          own tag, so tags only count up to the stage index if every stage
+ *          ran after its predecessor.
+ */
+struct pipeline_result {
+  std::vector<uint32_t> data;
+  std::vector<uint32_t> tags;
+};
+
+/**
+ * @brief Runs \p stages alternating device and host_task stages over buffers,
+ *        starting with a device stage
+ */
+inline pipeline_result run_buffer_pipeline(sycl::queue& queue, size_t stages) {
+  pipeline_result result{std::vector<uint32_t>(data_size, init_value),
+                         std::vector<uint32_t>(stages, 0)};
+  {
+    sycl::buffer<uint32_t, 1> data(result.data.data(),
+                                   sycl::range<1>(data_size));
+    sycl::buffer<uint32_t, 1> tags(result.tags.data(), sycl::range<1>(stages));
+
+    for (size_t s = 0; s < stages; ++s) {
+      const uint32_t stage = static_cast<uint32_t>(s);
+      if (is_host_stage(s)) {
+        queue.submit([&](sycl::handler& cgh) {
+          sycl::accessor d{data, cgh, sycl::read_write_host_task};
+          sycl::accessor t{tags, cgh, sycl::read_write_host_task};
+          cgh.host_task([=] {
+            for (size_t i = 0; i < data_size; ++i)
+              d[i] = host_stage(d[i], stage);
+            t[stage] = t[stage - 1] + 1;
+          });
+        });
+      } else {
+        queue.submit([&](sycl::handler& cgh) {
+          sycl::accessor d{data, cgh, sycl::read_write};
+          sycl::accessor t{tags, cgh, sycl::read_write};
+          cgh.parallel_for(sycl::range<1>(data_size), [=](sycl::id<1> i) {
+            d[i] = device_stage(d[i], stage);
+            if (i[0] == 0) t[stage] = stage == 0 ? 0 : t[stage - 1] + 1;
+          });
+        });
+      }
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Runs \p stages alternating device and host_task stages over USM on
+ *        an in-order queue; host tasks take an interop_handle
+ * @param queue In-order queue
+ * @param usm_data Host-accessible USM allocation of data_size elements
+ * @param usm_tags Host-accessible USM allocation of \p stages elements
+ * @param backend_mismatches Incremented by every host task whose
+ *                           interop_handle reports another backend than the
+ *                           queue
+ */
+inline void submit_usm_pipeline(sycl::queue& queue, size_t stages,
+                                uint32_t* usm_data, uint32_t* usm_tags,
+                                uint32_t* backend_mismatches) {
+  const sycl::backend backend = queue.get_backend();
+  for (size_t s = 0; s < stages; ++s) {
+    const uint32_t stage = static_cast<uint32_t>(s);
+    if (is_host_stage(s)) {
+      queue.submit([&](sycl::handler& cgh) {
+        cgh.host_task([=](sycl::interop_handle ih) {
+          if (ih.get_backend() != backend) ++*backend_mismatches;
+          for (size_t i = 0; i < data_size; ++i)
+            usm_data[i] = host_stage(usm_data[i], stage);
+          usm_tags[stage] = usm_tags[stage - 1] + 1;
+        });
+      });
+    } else {
+      queue.parallel_for(sycl::range<1>(data_size), [=](sycl::id<1> i) {
+        usm_data[i] = device_stage(usm_data[i], stage);
+        if (i[0] == 0)
+          usm_tags[stage] = stage == 0 ? 0 : usm_tags[stage - 1] + 1;
+      });
+    }
+  }
+}
+
+/**
+ * @brief Host memory for USM pipelines: shared allocations if supported,
+ *        host allocations otherwise
+ */
+class usm_pipeline_memory {
+ public:
+  usm_pipeline_memory(sycl::queue& queue, size_t stages)
+      : m_queue(queue), m_stages(stages) {
+    const bool shared =
+        queue.get_device().has(sycl::aspect::usm_shared_allocations);
+    const auto alloc = [&](size_t count) {
+      return shared ? sycl::malloc_shared<uint32_t>(count, queue)
+                    : sycl::malloc_host<uint32_t>(count, queue);
+    };
+    data = alloc(data_size);
+    tags = alloc(stages);
+    mismatches = alloc(1);
+    REQUIRE((data && tags && mismatches));
+    reset();
+  }
+
+  ~usm_pipeline_memory() {
+    sycl::free(data, m_queue);
+    sycl::free(tags, m_queue);
+    sycl::free(mismatches, m_queue);
+  }
+
+  usm_pipeline_memory(const usm_pipeline_memory&) = delete;
+  usm_pipeline_memory& operator=(const usm_pipeline_memory&) = delete;
+
+  void reset() {
+    std::fill(data, data + data_size, init_value);
+    std::fill(tags, tags + m_stages, 0);
+    *mismatches = 0;
+  }
+
+  pipeline_result result() const {
+    return {std::vector<uint32_t>(data, data + data_size),
+            std::vector<uint32_t>(tags, tags + m_stages)};
+  }
+
+  uint32_t* data = nullptr;
+  uint32_t* tags = nullptr;
+  uint32_t* mismatches = nullptr;
+
+ private:
+  sycl::queue& m_queue;
+  size_t m_stages;
+};
+
+/**
+ * @brief Checks the data and the stage tags of a pipeline of \p stages
+ */
+inline void verify_pipeline(const pipeline_result& result, size_t stages,
+                            const std::string& context) {
+  uint32_t expected = init_value;
+  for (size_t s = 0; s < stages; ++s) {
+    const uint32_t stage = static_cast<uint32_t>(s);
+    expected = is_host_stage(s) ? host_stage(expected, stage)
+                                : device_stage(expected, stage);
+  }
+
+  sycl_cts::failure_recorder<uint32_t> failures;
+  for (size_t i = 0; i < result.data.size(); ++i)
+    failures.check_equal("data", i, result.data[i], expected);
+  for (size_t s = 0; s < result.tags.size(); ++s)
+    failures.check_equal("stage tag", s, result.tags[s],
+                         static_cast<uint32_t>(s));
+  failures.report(context);
+}
+
+}  // namespace host_task_pipeline
+
+#endif  // __SYCLCTS_TESTS_HOST_TASK_PIPELINE_H
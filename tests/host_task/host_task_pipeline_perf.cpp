@@ -0,0 +1,123 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../common/performance.h"
+#include "host_task_pipeline.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace host_task_pipeline::tests {
+using namespace sycl_cts;
+
+constexpr size_t stage_counts[] = {10, 100, 1000, 10000};
+
+// Runs of every measurement, passed to performance::measure
+constexpr size_t warmup_runs = 1;
+constexpr size_t measured_runs = 3;
+
+// Duration of each host task of the saturation measurement
+constexpr auto host_task_duration = std::chrono::milliseconds(2);
+constexpr size_t concurrent_task_counts[] = {1, 2, 4, 8, 16, 32, 64};
+
+TEST_CASE("host_task pipeline latency per stage", "[host_task][performance]") {
+  auto default_queue = util::get_cts_object::queue();
+  sycl::queue in_order_queue{default_queue.get_context(),
+                             default_queue.get_device(),
+                             sycl::property::queue::in_order{}};
+  const auto device = default_queue.get_device();
+  const bool has_usm = device.has(sycl::aspect::usm_shared_allocations) ||
+                       device.has(sycl::aspect::usm_host_allocations);
+
+  for (const size_t stages : stage_counts) {
+    pipeline_result result;
+    const auto buffers = performance::measure(
+        [&] { result = run_buffer_pipeline(default_queue, stages); },
+        measured_runs, warmup_runs);
+    verify_pipeline(result, stages, "buffers");
+
+    performance::result res("host_task",
+                            std::to_string(stages) + " pipeline stages");
+    res.with("buffers", buffers)
+        .with("buffers per stage", buffers.median / stages, "us");
+
+    if (has_usm) {
+      usm_pipeline_memory memory(in_order_queue, stages);
+      const auto usm = performance::measure(
+          [&] {
+            memory.reset();
+            submit_usm_pipeline(in_order_queue, stages, memory.data,
+                                memory.tags, memory.mismatches);
+            in_order_queue.wait_and_throw();
+          },
+          measured_runs, warmup_runs);
+      CHECK(*memory.mismatches == 0);
+      verify_pipeline(memory.result(), stages, "USM");
+      res.with("USM", usm).with("USM per stage", usm.median / stages, "us");
+    }
+    res.record();
+  }
+}
+
+TEST_CASE("host_task thread pool saturation", "[host_task][performance]") {
+  auto queue = util::get_cts_object::queue();
+
+  for (const size_t tasks : concurrent_task_counts) {
+    std::atomic<size_t> completed{0};
+    std::atomic<size_t> running{0};
+    std::atomic<size_t> max_running{0};
+
+    const auto t = performance::measure(
+        [&] {
+          for (size_t i = 0; i < tasks; ++i) {
+            queue.submit([&](sycl::handler& cgh) {
+              cgh.host_task([&] {
+                const size_t now = ++running;
+                size_t seen = max_running.load();
+                while (now > seen &&
+                       !max_running.compare_exchange_weak(seen, now)) {
+                }
+                std::this_thread::sleep_for(host_task_duration);
+                --running;
+                ++completed;
+              });
+            });
+          }
+          queue.wait_and_throw();
+        },
+        measured_runs, warmup_runs);
+    CHECK(completed == (warmup_runs + measured_runs) * tasks);
+
+    // Tasks that ran at the same time on average, tasks is the ideal value
+    const double task_us =
+        std::chrono::duration<double, std::micro>(host_task_duration).count();
+    const double concurrency = t.median > 0 ? tasks * task_us / t.median : 0;
+    performance::result("host_task",
+                        std::to_string(tasks) + " independent host tasks")
+        .with("makespan", t)
+        .with("effective concurrency", concurrency, "tasks")
+        .with("max concurrently running", static_cast<double>(max_running),
+              "tasks")
+        .record();
+  }
+}
+
+}  // namespace host_task_pipeline::tests
@@ -0,0 +1,116 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides tests for kernels with many or large captured arguments
+//
+*******************************************************************************/
+
+#include "kernel_args_scaling.h"
+
+#include <string>
+
+namespace kernel_args_scaling_test {
+using namespace kernel_args_scaling;
+
+struct tag;
+
+// Kernels with larger arguments are only instantiated by the performance
+// tests, since they may not build for devices with the minimum
+// max_parameter_size
+
+template <size_t N>
+struct check_accessors {
+  void operator()(sycl::queue& queue) {
+    if constexpr (within_minimum(accessor_payload_size<N>())) {
+      check(queue);
+    }
+  }
+
+  void check(sycl::queue& queue) {
+    if (!fits(queue.get_device(), accessor_payload_size<N>())) {
+      WARN(N << " accessors exceed max_parameter_size, skipped");
+      return;
+    }
+    INFO(N << " accessors");
+    accessor_args<tag, N> args;
+    sycl::buffer<uint64_t> result{sycl::range<1>(1)};
+    args.submit(queue, result);
+    CHECK(sycl::host_accessor(result)[0] == expected_hash(N));
+  }
+};
+
+template <size_t N>
+struct check_pointers {
+  void operator()(sycl::queue& queue) {
+    if constexpr (within_minimum(pointer_payload_size<N>())) {
+      check(queue);
+    }
+  }
+
+  void check(sycl::queue& queue) {
+    if (!fits(queue.get_device(), pointer_payload_size<N>())) {
+      WARN(N << " USM pointers exceed max_parameter_size, skipped");
+      return;
+    }
+    INFO(N << " USM pointers");
+    pointer_args<tag, N> args(queue);
+    args.submit().wait_and_throw();
+    CHECK(args.result() == expected_hash(N));
+  }
+};
+
+template <size_t Bytes>
+struct check_struct {
+  void operator()(sycl::queue& queue) {
+    if constexpr (within_minimum(struct_payload_size<Bytes>())) {
+      check(queue);
+    }
+  }
+
+  void check(sycl::queue& queue) {
+    if (!fits(queue.get_device(), struct_payload_size<Bytes>())) {
+      WARN(Bytes << " byte struct exceeds max_parameter_size, skipped");
+      return;
+    }
+    INFO(Bytes << " byte struct");
+    sycl::buffer<uint64_t> result{sycl::range<1>(1)};
+    submit_struct<tag>(queue, make_payload<Bytes>(), result);
+    CHECK(sycl::host_accessor(result)[0] ==
+          expected_hash(payload<Bytes>::words));
+  }
+};
+
+TEST_CASE("Kernels capturing many accessors", "[kernel_args]") {
+  auto queue = util::get_cts_object::queue();
+  for_each_size<check_accessors>(arg_counts{}, queue);
+}
+
+TEST_CASE("Kernels capturing many USM pointers", "[kernel_args]") {
+  auto queue = util::get_cts_object::queue();
+  if (!queue.get_device().has(sycl::aspect::usm_device_allocations)) {
+    SKIP("Device does not support device allocations");
+  }
+  for_each_size<check_pointers>(arg_counts{}, queue);
+}
+
+TEST_CASE("Kernels capturing large structs", "[kernel_args]") {
+  auto queue = util::get_cts_object::queue();
+  for_each_size<check_struct>(struct_sizes{}, queue);
+}
+
+}  // namespace kernel_args_scaling_test
@@ -0,0 +1,240 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Kernels capturing a growing number of accessors and USM pointers, and
+//  growing trivially copyable structs
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_KERNEL_ARGS_SCALING_H
+#define __SYCLCTS_TESTS_KERNEL_ARGS_SCALING_H
+
+#include "../../util/usm_helper.h"
+#include "../common/common.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace kernel_args_scaling {
+using namespace sycl_cts;
+
+// Numbers of captured accessors or USM pointers
+using arg_counts = std::index_sequence<1, 4, 16, 64, 128, 256>;
+// Sizes in bytes of the captured struct
+using struct_sizes =
+    std::index_sequence<16, 64, 256, 1024, 2048, 4096, 8192, 16384>;
+
+template <typename Tag, size_t N>
+class accessor_kernel;
+template <typename Tag, size_t N>
+class pointer_kernel;
+template <typename Tag, size_t Bytes>
+class struct_kernel;
+
+using read_accessor = sycl::accessor<uint32_t, 1, sycl::access_mode::read>;
+using result_accessor = sycl::accessor<uint64_t, 1, sycl::access_mode::write>;
+
+/** @brief Value held by the argument at \p index
+ */
+inline uint32_t arg_value(size_t index) {
+  return static_cast<uint32_t>(index * 7 + 1);
+}
+
+/** @brief Order-sensitive hash of the first \p count argument values, as
+ *         computed by the kernels
+ */
+inline uint64_t expected_hash(size_t count) {
+  uint64_t hash = 0;
+  for (size_t i = 0; i < count; ++i) hash = hash * 31 + arg_value(i);
+  return hash;
+}
+
+/** @brief Calls ActionT<Size>{}(args...) for every size of the sequence
+ */
+template <template <size_t> class ActionT, size_t... Sizes, typename... ArgsT>
+void for_each_size(std::index_sequence<Sizes...>, ArgsT&&... args) {
+  (ActionT<Sizes>{}(args...), ...);
+}
+
+/** @brief Estimated kernel parameter size; host-side object sizes are used,
+ *         so the actual device-side size may differ
+ */
+template <size_t N>
+constexpr size_t accessor_payload_size() {
+  return N * sizeof(read_accessor) + sizeof(result_accessor);
+}
+
+template <size_t N>
+constexpr size_t pointer_payload_size() {
+  return (N + 1) * sizeof(void*);
+}
+
+template <size_t Bytes>
+constexpr size_t struct_payload_size() {
+  return Bytes + sizeof(result_accessor);
+}
+
+// Smallest max_parameter_size the specification allows
+constexpr size_t min_max_parameter_size = 1024;
+
+/** @brief Whether kernel arguments of \p bytes fit on every device, so the
+ *         kernel can be instantiated in translation units shared with other
+ *         kernels
+ */
+constexpr bool within_minimum(size_t bytes) {
+  return bytes <= min_max_parameter_size;
+}
+
+/** @brief Checks \p bytes of kernel arguments against max_parameter_size
+ */
+inline bool fits(const sycl::device& device, size_t bytes) {
+  return bytes <= device.get_info<sycl::info::device::max_parameter_size>();
+}
+
+/**
+ * @brief N single-element buffers, captured by the kernel as N separate
+ *        accessors
+ */
+template <typename Tag, size_t N>
+class accessor_args {
+ public:
+  accessor_args() {
+    m_buffers.reserve(N);
+    for (size_t i = 0; i < N; ++i) {
+      m_buffers.emplace_back(sycl::range<1>(1));
+      sycl::host_accessor acc(m_buffers.back(), sycl::write_only);
+      acc[0] = arg_value(i);
+    }
+  }
+
+  sycl::event submit(sycl::queue& queue, sycl::buffer<uint64_t>& result) {
+    return queue.submit([&](sycl::handler& cgh) {
+      result_accessor out(result, cgh, {sycl::no_init});
+      launch(cgh, out, std::make_index_sequence<N>{});
+    });
+  }
+
+ private:
+  template <size_t... I>
+  void launch(sycl::handler& cgh, result_accessor out,
+              std::index_sequence<I...>) {
+    run(cgh, out, read_accessor(m_buffers[I], cgh)...);
+  }
+
+  template <typename... AccT>
+  static void run(sycl::handler& cgh, result_accessor out, AccT... accs) {
+    cgh.single_task<accessor_kernel<Tag, N>>([=] {
+      uint64_t hash = 0;
+      ((hash = hash * 31 + accs[0]), ...);
+      out[0] = hash;
+    });
+  }
+
+  std::vector<sycl::buffer<uint32_t>> m_buffers;
+};
+
+/**
+ * @brief N pointers into a device allocation, captured by the kernel as N
+ *        separate USM pointers
+ */
+template <typename Tag, size_t N>
+class pointer_args {
+ public:
+  explicit pointer_args(sycl::queue& queue)
+      : m_queue(queue),
+        m_data(usm_helper::allocate_usm_memory<sycl::usm::alloc::device,
+                                               uint32_t>(queue, N)),
+        m_result(usm_helper::allocate_usm_memory<sycl::usm::alloc::device,
+                                                 uint64_t>(queue, 1)) {
+    std::vector<uint32_t> values(N);
+    for (size_t i = 0; i < N; ++i) values[i] = arg_value(i);
+    m_queue.copy(values.data(), m_data.get(), N).wait_and_throw();
+  }
+
+  sycl::event submit() { return launch(std::make_index_sequence<N>{}); }
+
+  uint64_t result() {
+    uint64_t value = 0;
+    m_queue.copy(m_result.get(), &value, 1).wait_and_throw();
+    return value;
+  }
+
+ private:
+  template <size_t... I>
+  sycl::event launch(std::index_sequence<I...>) {
+    const uint32_t* data = m_data.get();
+    return run(m_result.get(), (data + I)...);
+  }
+
+  template <typename... PtrT>
+  sycl::event run(uint64_t* out, PtrT... ptrs) {
+    return m_queue.single_task<pointer_kernel<Tag, N>>([=] {
+      uint64_t hash = 0;
+      ((hash = hash * 31 + *ptrs), ...);
+      *out = hash;
+    });
+  }
+
+  template <typename T>
+  using device_ptr =
+      decltype(usm_helper::allocate_usm_memory<sycl::usm::alloc::device, T>(
+          std::declval<const sycl::queue&>()));
+
+  sycl::queue m_queue;
+  device_ptr<uint32_t> m_data;
+  device_ptr<uint64_t> m_result;
+};
+
+/** @brief Trivially copyable struct of \p Bytes bytes
+ */
+template <size_t Bytes>
+struct payload {
+  static_assert(Bytes % sizeof(uint32_t) == 0,
+                "Payload size should be a multiple of its word size");
+  static constexpr size_t words = Bytes / sizeof(uint32_t);
+  uint32_t data[words];
+};
+
+template <size_t Bytes>
+payload<Bytes> make_payload() {
+  payload<Bytes> p{};
+  for (size_t i = 0; i < payload<Bytes>::words; ++i) p.data[i] = arg_value(i);
+  return p;
+}
+
+/** @brief Submits a kernel capturing \p p by value
+ */
+template <typename Tag, size_t Bytes>
+sycl::event submit_struct(sycl::queue& queue, const payload<Bytes>& p,
+                          sycl::buffer<uint64_t>& result) {
+  return queue.submit([&](sycl::handler& cgh) {
+    result_accessor out(result, cgh, {sycl::no_init});
+    const payload<Bytes> captured = p;
+    cgh.single_task<struct_kernel<Tag, Bytes>>([=] {
+      uint64_t hash = 0;
+      for (size_t i = 0; i < payload<Bytes>::words; ++i)
+        hash = hash * 31 + captured.data[i];
+      out[0] = hash;
+    });
+  });
+}
+
+}  // namespace kernel_args_scaling
+
+#endif  // __SYCLCTS_TESTS_KERNEL_ARGS_SCALING_H
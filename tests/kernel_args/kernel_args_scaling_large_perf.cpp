@@ -0,0 +1,35 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures submission latency of kernels whose captured arguments are
+//  above the specification minimum of max_parameter_size
+//
+*******************************************************************************/
+
+#include "kernel_args_scaling_perf.h"
+
+namespace kernel_args_scaling_large_perf_test {
+
+struct tag;
+
+TEST_CASE("Submission latency of kernels with large arguments",
+          "[kernel_args][performance]") {
+  kernel_args_scaling_perf::cases<tag, true>::run_all();
+}
+
+}  // namespace kernel_args_scaling_large_perf_test
@@ -0,0 +1,161 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Common code for measuring submission latency of kernels against the size
+//  of their captured arguments
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_KERNEL_ARGS_SCALING_PERF_H
+#define __SYCLCTS_TESTS_KERNEL_ARGS_SCALING_PERF_H
+
+#include "../common/performance.h"
+#include "kernel_args_scaling.h"
+
+#include <string>
+
+namespace kernel_args_scaling_perf {
+using namespace kernel_args_scaling;
+
+// Commands per measured batch
+constexpr size_t batch = 100;
+// Batches measured for the submission alone, after the warm-up batches
+constexpr size_t submission_samples = 3;
+constexpr size_t submission_warmup = 1;
+
+/**
+ * @brief Measures submission alone and submission with execution of
+ *        \p submit, then records both against \p payload_bytes
+ */
+template <typename SubmitT>
+void measure_and_record(sycl::queue& queue, const std::string& name,
+                        size_t payload_bytes, SubmitT&& submit) {
+  const auto submission = performance::measure(
+      [&] {
+        for (size_t i = 0; i < batch; ++i) submit();
+      },
+      submission_samples, submission_warmup);
+  queue.wait_and_throw();
+  const auto total = performance::measure_commands(queue, batch, submit);
+
+  performance::result("kernel_args", name)
+      .with("payload", static_cast<double>(payload_bytes), "bytes")
+      .with("submit", submission.median / batch, "us")
+      .with("submit + execute", total)
+      .record();
+}
+
+/**
+ * @brief Runs \p f, turning errors of building or passing the kernel
+ *        arguments into a skipped case
+ */
+template <typename FunctorT>
+void skip_on_build_error(const std::string& name, FunctorT&& f) {
+  try {
+    f();
+  } catch (const sycl::exception& e) {
+    if (e.code() != sycl::errc::build &&
+        e.code() != sycl::errc::kernel_argument)
+      throw;
+    WARN(name << " could not be built or launched, skipped: " << e.what());
+  }
+}
+
+/**
+ * @brief Measurements of the cases whose estimated payload is within the
+ *        specification minimum of max_parameter_size, or only of the larger
+ *        ones if \p Large is true
+ * @details Both groups are instantiated in separate translation units, so
+ *          a large kernel that fails to build cannot affect the others.
+ */
+template <typename Tag, bool Large>
+struct cases {
+  static constexpr bool selected(size_t bytes) {
+    return within_minimum(bytes) != Large;
+  }
+
+  template <size_t N>
+  struct accessors {
+    void operator()(sycl::queue& queue) {
+      if constexpr (selected(accessor_payload_size<N>())) run(queue);
+    }
+
+    void run(sycl::queue& queue) {
+      if (!fits(queue.get_device(), accessor_payload_size<N>())) return;
+      const std::string name = std::to_string(N) + " accessors";
+      skip_on_build_error(name, [&] {
+        accessor_args<Tag, N> args;
+        sycl::buffer<uint64_t> result{sycl::range<1>(1)};
+        measure_and_record(queue, name, accessor_payload_size<N>(),
+                           [&] { args.submit(queue, result); });
+        CHECK(sycl::host_accessor(result)[0] == expected_hash(N));
+      });
+    }
+  };
+
+  template <size_t N>
+  struct pointers {
+    void operator()(sycl::queue& queue) {
+      if constexpr (selected(pointer_payload_size<N>())) run(queue);
+    }
+
+    void run(sycl::queue& queue) {
+      if (!fits(queue.get_device(), pointer_payload_size<N>())) return;
+      const std::string name = std::to_string(N) + " USM pointers";
+      skip_on_build_error(name, [&] {
+        pointer_args<Tag, N> args(queue);
+        measure_and_record(queue, name, pointer_payload_size<N>(),
+                           [&] { args.submit(); });
+        CHECK(args.result() == expected_hash(N));
+      });
+    }
+  };
+
+  template <size_t Bytes>
+  struct structs {
+    void operator()(sycl::queue& queue) {
+      if constexpr (selected(struct_payload_size<Bytes>())) run(queue);
+    }
+
+    void run(sycl::queue& queue) {
+      if (!fits(queue.get_device(), struct_payload_size<Bytes>())) return;
+      const std::string name = std::to_string(Bytes) + " byte struct";
+      skip_on_build_error(name, [&] {
+        const auto p = make_payload<Bytes>();
+        sycl::buffer<uint64_t> result{sycl::range<1>(1)};
+        measure_and_record(queue, name, struct_payload_size<Bytes>(),
+                           [&] { submit_struct<Tag>(queue, p, result); });
+        CHECK(sycl::host_accessor(result)[0] ==
+              expected_hash(payload<Bytes>::words));
+      });
+    }
+  };
+
+  static void run_all() {
+    auto queue = util::get_cts_object::queue();
+    for_each_size<accessors>(arg_counts{}, queue);
+    if (queue.get_device().has(sycl::aspect::usm_device_allocations)) {
+      for_each_size<pointers>(arg_counts{}, queue);
+    }
+    for_each_size<structs>(struct_sizes{}, queue);
+  }
+};
+
+}  // namespace kernel_args_scaling_perf
+
+#endif  // __SYCLCTS_TESTS_KERNEL_ARGS_SCALING_PERF_H
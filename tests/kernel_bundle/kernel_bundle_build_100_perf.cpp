@@ -0,0 +1,21 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the cost of building a kernel bundle of 100 kernels
+//
+//  The test is built as a separate executable, so its kernels are the only
+//  ones in the application.
+//
+*******************************************************************************/
+
+#include "kernel_bundle_build_perf.h"
+
+namespace kernel_bundle_build_100_perf {
+
+TEST_CASE("Kernel bundle compile, link and build cost of 100 kernels",
+          "[kernel_bundle][performance]") {
+  kernel_bundle_build_perf::run_build_perf<100>();
+}
+
+}  // namespace kernel_bundle_build_100_perf
@@ -0,0 +1,21 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures the cost of building a kernel bundle of 1 kernel
+//
+//  The test is built as a separate executable, so its kernels are the only
+//  ones in the application.
+//
+*******************************************************************************/
+
+#include "kernel_bundle_build_perf.h"
+
+namespace kernel_bundle_build_1_perf {
+
+TEST_CASE("Kernel bundle compile, link and build cost of 1 kernel",
+          "[kernel_bundle][performance]") {
+  kernel_bundle_build_perf::run_build_perf<1>();
+}
+
+}  // namespace kernel_bundle_build_1_perf
@@ -0,0 +1,136 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Provides common code for measuring the cost of building kernel bundles
+//
+//  Every kernel set is measured in an executable of its own, so its kernels
+//  are the only ones of the application and none of them was built before.
+//  The steps are measured in this order:
+//    1) get_kernel_bundle<input>, sycl::compile, sycl::link and sycl::build,
+//  once each, before any executable bundle is requested, so they are cold;
+//    2) the first get_kernel_bundle<executable>;
+//    3) repeated sycl::build of the input bundle and repeated
+//  get_kernel_bundle<executable>, the latter is expected to be served from
+//  the program cache of the runtime.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_KERNEL_BUNDLE_BUILD_PERF_H
+#define __SYCLCTS_TESTS_KERNEL_BUNDLE_BUILD_PERF_H
+
+#include "../common/common.h"
+#include "../common/failure_recorder.h"
+#include "../common/performance.h"
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace kernel_bundle_build_perf {
+using namespace sycl_cts;
+
+// Samples of the repeated build and get_kernel_bundle<executable> calls
+constexpr size_t warm_samples = 5;
+constexpr size_t warm_warmup = 0;
+
+template <int Count, int I>
+class kernel_build_perf;
+
+template <int Count, int... Is>
+void run_kernels(sycl::queue& queue, int* out,
+                 std::integer_sequence<int, Is...>) {
+  (queue.single_task<kernel_build_perf<Count, Is>>([=] { out[Is] = Is; }),
+   ...);
+}
+
+template <int Count, int... Is>
+std::vector<sycl::kernel_id> get_kernel_ids(
+    std::integer_sequence<int, Is...>) {
+  return {sycl::get_kernel_id<kernel_build_perf<Count, Is>>()...};
+}
+
+/**
+ * @brief Measures the kernel bundle operations for a set of \p Count kernels
+ *        and verifies the kernels afterwards
+ */
+template <int Count>
+void run_build_perf() {
+  auto queue = util::get_cts_object::queue();
+  const auto ctx = queue.get_context();
+  const auto dev = queue.get_device();
+  const auto ids =
+      get_kernel_ids<Count>(std::make_integer_sequence<int, Count>{});
+  const std::string name =
+      std::to_string(Count) + (Count == 1 ? " kernel" : " kernels");
+  performance::result result("kernel_bundle", name);
+
+  std::optional<sycl::kernel_bundle<sycl::bundle_state::input>> input;
+  const bool has_input =
+      sycl::has_kernel_bundle<sycl::bundle_state::input>(ctx, {dev}, ids);
+  if (has_input) {
+    result.with("get_kernel_bundle<input>", performance::time_us([&] {
+                  input = sycl::get_kernel_bundle<sycl::bundle_state::input>(
+                      ctx, {dev}, ids);
+                }),
+                "us");
+
+    if (dev.has(sycl::aspect::online_compiler)) {
+      std::optional<sycl::kernel_bundle<sycl::bundle_state::object>> object;
+      result.with("compile",
+                  performance::time_us([&] { object = sycl::compile(*input); }),
+                  "us");
+      if (dev.has(sycl::aspect::online_linker)) {
+        std::optional<sycl::kernel_bundle<sycl::bundle_state::executable>>
+            linked;
+        result.with("link",
+                    performance::time_us([&] { linked = sycl::link(*object); }),
+                    "us");
+        for (const auto& id : ids) CHECK(linked->has_kernel(id));
+        result.with("first build",
+                    performance::time_us([&] { sycl::build(*input); }), "us");
+      }
+    }
+  }
+
+  const auto get_executable = [&] {
+    sycl::get_kernel_bundle<sycl::bundle_state::executable>(ctx, {dev}, ids);
+  };
+  result.with("first get_kernel_bundle<executable>",
+              performance::time_us(get_executable), "us");
+  const auto executable =
+      performance::measure(get_executable, warm_samples, warm_warmup);
+  result.with("get_kernel_bundle<executable> again", executable);
+
+  if (input && dev.has(sycl::aspect::online_compiler) &&
+      dev.has(sycl::aspect::online_linker)) {
+    const auto build = performance::measure(
+        [&] { sycl::build(*input); }, warm_samples, warm_warmup);
+    // A cached executable bundle should be much cheaper than a build
+    const double ratio =
+        executable.median > 0 ? build.median / executable.median : 0;
+    result.with("build again", build)
+        .with("build / cached get_kernel_bundle<executable>", ratio, "x");
+    if (ratio <= 1)
+      WARN(name << ": get_kernel_bundle<executable> is not faster than "
+                   "sycl::build, the program cache may be unused");
+  }
+  result.record();
+
+  int* out = sycl::malloc_device<int>(Count, queue);
+  REQUIRE(out != nullptr);
+  run_kernels<Count>(queue, out, std::make_integer_sequence<int, Count>{});
+  std::vector<int> values(Count);
+  queue.copy(out, values.data(), Count).wait_and_throw();
+  sycl::free(out, queue);
+
+  failure_recorder<int> failures;
+  for (int i = 0; i < Count; ++i)
+    failures.check_equal("kernel result", i, values[i], i);
+  failures.report(name);
+}
+
+}  // namespace kernel_bundle_build_perf
+
+#endif  // __SYCLCTS_TESTS_KERNEL_BUNDLE_BUILD_PERF_H
@@ -0,0 +1,308 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Checks unary half precision math builtins for all 65536 bit patterns and
+//  binary ones for a dense sample of argument pairs
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+#include "../common/failure_recorder.h"
+#include "math_builtin.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <string>
+#include <vector>
+
+namespace math_builtin_exhaustive_fp16 {
+using namespace sycl_cts;
+
+constexpr size_t patterns = 1 << 16;
+// Every binary_stride-th bit pattern is used as an argument of the binary
+// builtins. The stride keeps zeros, one, infinities and the default NaN in the
+// sample, other special values are added explicitly.
+constexpr size_t binary_stride = 64;
+
+inline bool is_subnormal(uint16_t bits) {
+  return (bits & 0x7C00) == 0 && (bits & 0x03FF) != 0;
+}
+
+/**
+ * @brief Declares a builtin descriptor used by the sweeps below
+ * @param NAME Name of the builtin in both sycl:: and reference::
+ * @param ULP Accuracy from the SYCL specification, see sycl_functions.py
+ * @param REF_T Argument type of the reference call. float selects the
+ *              reference overloads which compute in double, sycl::half the
+ *              ones which are exact for half precision only.
+ */
+#define UNARY_BUILTIN(NAME, ULP, REF_T)                                   \
+  struct NAME##_builtin {                                                 \
+    static constexpr const char* name = #NAME;                            \
+    static constexpr float accuracy = ULP;                                \
+    static sycl::half device(sycl::half x) { return sycl::NAME(x); }      \
+    static resultRef<sycl::half> reference(sycl::half x) {                \
+      return resultRef<sycl::half>(                                       \
+          ::reference::NAME(static_cast<REF_T>(x)));                      \
+    }                                                                     \
+  };
+
+#define BINARY_BUILTIN(NAME, ULP, REF_T)                                  \
+  struct NAME##_builtin {                                                 \
+    static constexpr const char* name = #NAME;                            \
+    static constexpr float accuracy = ULP;                                \
+    static sycl::half device(sycl::half x, sycl::half y) {                \
+      return sycl::NAME(x, y);                                            \
+    }                                                                     \
+    static resultRef<sycl::half> reference(sycl::half x, sycl::half y) {  \
+      return resultRef<sycl::half>(::reference::NAME(                     \
+          static_cast<REF_T>(x), static_cast<REF_T>(y)));                 \
+    }                                                                     \
+  };
+
+UNARY_BUILTIN(acos, 4, float)
+UNARY_BUILTIN(acosh, 4, float)
+UNARY_BUILTIN(acospi, 5, float)
+UNARY_BUILTIN(asin, 4, float)
+UNARY_BUILTIN(asinh, 4, float)
+UNARY_BUILTIN(asinpi, 5, float)
+UNARY_BUILTIN(atan, 5, float)
+UNARY_BUILTIN(atanh, 5, float)
+UNARY_BUILTIN(atanpi, 5, float)
+UNARY_BUILTIN(cbrt, 2, float)
+UNARY_BUILTIN(ceil, 0, float)
+UNARY_BUILTIN(cos, 4, float)
+UNARY_BUILTIN(cosh, 4, float)
+UNARY_BUILTIN(cospi, 4, float)
+UNARY_BUILTIN(erfc, 16, float)
+UNARY_BUILTIN(erf, 16, float)
+UNARY_BUILTIN(exp, 3, float)
+UNARY_BUILTIN(exp2, 3, float)
+UNARY_BUILTIN(exp10, 3, float)
+UNARY_BUILTIN(expm1, 3, float)
+UNARY_BUILTIN(fabs, 0, float)
+UNARY_BUILTIN(floor, 0, float)
+UNARY_BUILTIN(log, 3, float)
+UNARY_BUILTIN(log2, 3, float)
+UNARY_BUILTIN(log10, 3, float)
+UNARY_BUILTIN(log1p, 2, float)
+UNARY_BUILTIN(logb, 0, float)
+UNARY_BUILTIN(rint, 0, float)
+UNARY_BUILTIN(round, 0, float)
+UNARY_BUILTIN(rsqrt, 2, float)
+UNARY_BUILTIN(sin, 4, float)
+UNARY_BUILTIN(sinh, 4, float)
+UNARY_BUILTIN(sinpi, 4, float)
+UNARY_BUILTIN(sqrt, 3, float)
+UNARY_BUILTIN(tan, 5, float)
+UNARY_BUILTIN(tanh, 5, float)
+UNARY_BUILTIN(tanpi, 6, float)
+UNARY_BUILTIN(tgamma, 16, float)
+UNARY_BUILTIN(trunc, 0, float)
+
+BINARY_BUILTIN(atan2, 6, float)
+BINARY_BUILTIN(atan2pi, 6, float)
+BINARY_BUILTIN(copysign, 0, float)
+// The difference of two half values is not always exact in float
+BINARY_BUILTIN(fdim, 0, sycl::half)
+BINARY_BUILTIN(fmax, 0, float)
+BINARY_BUILTIN(fmin, 0, float)
+BINARY_BUILTIN(fmod, 0, float)
+BINARY_BUILTIN(hypot, 4, float)
+// The step has to be taken in half precision
+BINARY_BUILTIN(nextafter, 0, sycl::half)
+BINARY_BUILTIN(pow, 16, float)
+BINARY_BUILTIN(powr, 16, float)
+BINARY_BUILTIN(remainder, 0, float)
+
+#undef UNARY_BUILTIN
+#undef BINARY_BUILTIN
+
+template <typename... Builtins>
+class unary_kernel;
+template <typename... Builtins>
+class binary_kernel;
+
+/**
+ * @brief Checks the results of a single builtin and reports all failures
+ * @param index_to_args Maps the index of a result to its arguments
+ */
+template <typename Builtin, typename IndexToArgsT>
+void check_results(const sycl::half* results, size_t count, bool has_denorm,
+                   const IndexToArgsT& index_to_args,
+                   const std::string& index_description) {
+  failure_recorder<float> failures;
+  for (size_t i = 0; i < count; ++i) {
+    const auto args = index_to_args(i);
+    if (!has_denorm && std::apply(
+                           [](auto... bits) {
+                             return (is_subnormal(bits) || ...);
+                           },
+                           args))
+      continue;
+
+    const resultRef<sycl::half> expected = std::apply(
+        [](auto... bits) {
+          return Builtin::reference(sycl::bit_cast<sycl::half>(bits)...);
+        },
+        args);
+    failures.check(within_accuracy(results[i], expected, Builtin::accuracy,
+                                   AccuracyMode::ULP),
+                   Builtin::name, i, results[i], expected.res);
+  }
+  failures.report(std::string(Builtin::name) + "(half), expected accuracy " +
+                  std::to_string(Builtin::accuracy) + " ULP, " +
+                  index_description);
+}
+
+/**
+ * @brief Runs all unary builtins on every bit pattern in a single kernel
+ */
+template <typename... Builtins>
+void check_unary(sycl::queue& q, bool has_denorm) {
+  constexpr size_t builtin_count = sizeof...(Builtins);
+  std::vector<sycl::half> host(builtin_count * patterns);
+
+  sycl::half* results = sycl::malloc_device<sycl::half>(host.size(), q);
+  REQUIRE(results != nullptr);
+
+  q.parallel_for<unary_kernel<Builtins...>>(
+       sycl::range<1>(patterns), [=](sycl::id<1> idx) {
+         const size_t p = idx[0];
+         const auto x = sycl::bit_cast<sycl::half>(static_cast<uint16_t>(p));
+         size_t offset = p;
+         ((results[offset] = Builtins::device(x), offset += patterns), ...);
+       })
+      .wait_and_throw();
+  q.copy(results, host.data(), host.size()).wait_and_throw();
+  sycl::free(results, q);
+
+  const auto index_to_args = [](size_t i) {
+    return std::make_tuple(static_cast<uint16_t>(i));
+  };
+  size_t offset = 0;
+  ((check_results<Builtins>(host.data() + offset, patterns, has_denorm,
+                            index_to_args, "element is the argument bits"),
+    offset += patterns),
+   ...);
+}
+
+/**
+ * @brief Bit patterns used as arguments of the binary builtins
+ */
+std::vector<uint16_t> binary_sample() {
+  std::vector<uint16_t> sample;
+  for (size_t p = 0; p < patterns; p += binary_stride)
+    sample.push_back(static_cast<uint16_t>(p));
+  // Smallest and largest subnormal, smallest normal, largest finite value and
+  // the neighbours of one
+  for (const uint16_t bits : {0x0001, 0x03FF, 0x0400, 0x7BFF, 0x3BFF, 0x3C01}) {
+    sample.push_back(bits);
+    sample.push_back(static_cast<uint16_t>(bits | 0x8000));
+  }
+  return sample;
+}
+
+/**
+ * @brief Runs all binary builtins on every pair of the sample in a single
+ *        kernel
+ */
+template <typename... Builtins>
+void check_binary(sycl::queue& q, bool has_denorm) {
+  constexpr size_t builtin_count = sizeof...(Builtins);
+  const std::vector<uint16_t> sample = binary_sample();
+  const size_t n = sample.size();
+  const size_t pairs = n * n;
+  std::vector<sycl::half> host(builtin_count * pairs);
+
+  uint16_t* args = sycl::malloc_device<uint16_t>(n, q);
+  sycl::half* results = sycl::malloc_device<sycl::half>(host.size(), q);
+  REQUIRE((args && results));
+  q.copy(sample.data(), args, n).wait_and_throw();
+
+  q.parallel_for<binary_kernel<Builtins...>>(
+       sycl::range<2>(n, n), [=](sycl::id<2> idx) {
+         const auto x = sycl::bit_cast<sycl::half>(args[idx[0]]);
+         const auto y = sycl::bit_cast<sycl::half>(args[idx[1]]);
+         size_t offset = idx[0] * n + idx[1];
+         ((results[offset] = Builtins::device(x, y), offset += pairs), ...);
+       })
+      .wait_and_throw();
+  q.copy(results, host.data(), host.size()).wait_and_throw();
+  sycl::free(args, q);
+  sycl::free(results, q);
+
+  const auto index_to_args = [&sample, n](size_t i) {
+    return std::make_tuple(sample[i / n], sample[i % n]);
+  };
+  const std::string index_description =
+      "element is x * " + std::to_string(n) + " + y for x and y indexing " +
+      "every " + std::to_string(binary_stride) +
+      "th bit pattern followed by special values";
+  size_t offset = 0;
+  ((check_results<Builtins>(host.data() + offset, pairs, has_denorm,
+                            index_to_args, index_description),
+    offset += pairs),
+   ...);
+}
+
+TEST_CASE("Half precision math builtins over all unary arguments",
+          "[math_builtin_api][half]") {
+  auto q = util::get_cts_object::queue();
+  if (!q.get_device().has(sycl::aspect::fp16)) {
+    SKIP("Device does not support half precision floating point operations.");
+  }
+  // Devices without denormal support may flush subnormal arguments
+  const auto fp_config =
+      q.get_device().get_info<sycl::info::device::half_fp_config>();
+  const bool has_denorm =
+      std::find(fp_config.begin(), fp_config.end(),
+                sycl::info::fp_config::denorm) != fp_config.end();
+
+  check_unary<acos_builtin, acosh_builtin, acospi_builtin, asin_builtin,
+              asinh_builtin, asinpi_builtin, atan_builtin, atanh_builtin,
+              atanpi_builtin, cbrt_builtin, ceil_builtin, cos_builtin,
+              cosh_builtin, cospi_builtin, erfc_builtin, erf_builtin,
+              exp_builtin, exp2_builtin, exp10_builtin, expm1_builtin,
+              fabs_builtin, floor_builtin, log_builtin, log2_builtin,
+              log10_builtin, log1p_builtin, logb_builtin, rint_builtin,
+              round_builtin, rsqrt_builtin, sin_builtin, sinh_builtin,
+              sinpi_builtin, sqrt_builtin, tan_builtin, tanh_builtin,
+              tanpi_builtin, tgamma_builtin, trunc_builtin>(q, has_denorm);
+}
+
+TEST_CASE("Half precision math builtins over sampled binary arguments",
+          "[math_builtin_api][half]") {
+  auto q = util::get_cts_object::queue();
+  if (!q.get_device().has(sycl::aspect::fp16)) {
+    SKIP("Device does not support half precision floating point operations.");
+  }
+  const auto fp_config =
+      q.get_device().get_info<sycl::info::device::half_fp_config>();
+  const bool has_denorm =
+      std::find(fp_config.begin(), fp_config.end(),
+                sycl::info::fp_config::denorm) != fp_config.end();
+
+  check_binary<atan2_builtin, atan2pi_builtin, copysign_builtin, fdim_builtin,
+               fmax_builtin, fmin_builtin, fmod_builtin, hypot_builtin,
+               nextafter_builtin, pow_builtin, powr_builtin,
+               remainder_builtin>(q, has_denorm);
+}
+
+}  // namespace math_builtin_exhaustive_fp16
@@ -0,0 +1,70 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+
+namespace queue_concurrency::tests {
+using namespace sycl_cts;
+
+constexpr uint32_t serialized_commands = 10000;
+// Every this many commands a host_task takes the place of a kernel
+constexpr uint32_t host_task_interval = 100;
+
+TEST_CASE("in_order queue serializes kernels and host tasks at scale",
+          "[queue]") {
+  auto default_queue = util::get_cts_object::queue();
+  if (!default_queue.get_device().has(sycl::aspect::usm_shared_allocations)) {
+    SKIP("Device does not support USM shared allocations");
+  }
+  sycl::queue queue{default_queue.get_context(), default_queue.get_device(),
+                    sycl::property::queue::in_order{}};
+
+  // Each command checks that all previous commands have completed by
+  // comparing the counter with its own index before incrementing it
+  uint32_t* counter = sycl::malloc_shared<uint32_t>(1, queue);
+  uint32_t* out_of_order = sycl::malloc_shared<uint32_t>(1, queue);
+  REQUIRE((counter && out_of_order));
+  *counter = 0;
+  *out_of_order = 0;
+
+  for (uint32_t i = 0; i < serialized_commands; ++i) {
+    if (i % host_task_interval == host_task_interval - 1) {
+      queue.submit([&](sycl::handler& cgh) {
+        cgh.host_task([=] {
+          if (*counter != i) ++*out_of_order;
+          *counter = i + 1;
+        });
+      });
+    } else {
+      queue.single_task([=] {
+        if (*counter != i) ++*out_of_order;
+        *counter = i + 1;
+      });
+    }
+  }
+  queue.wait_and_throw();
+
+  CHECK(*out_of_order == 0);
+  CHECK(*counter == serialized_commands);
+  sycl::free(counter, queue);
+  sycl::free(out_of_order, queue);
+}
+
+}  // namespace queue_concurrency::tests
@@ -0,0 +1,144 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+#include "../common/performance.h"
+#include "../event/event_profiling.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace queue_concurrency::tests {
+using namespace sycl_cts;
+using namespace event_profiling;
+
+// Each independent command runs for about this long
+constexpr auto command_duration = std::chrono::milliseconds(5);
+constexpr size_t independent_counts[] = {1, 2, 4, 8, 16};
+
+/**
+ * @brief Ratio of the summed profiled durations of \p events to the interval
+ *        from the first start to the last end, 1 if nothing overlapped
+ */
+inline double profiled_concurrency(const std::vector<sycl::event>& events) {
+  uint64_t first_start = std::numeric_limits<uint64_t>::max();
+  uint64_t last_end = 0;
+  uint64_t busy = 0;
+  for (const auto& event : events) {
+    const profile p = get_profile(event);
+    first_start = std::min(first_start, p.start);
+    last_end = std::max(last_end, p.end);
+    busy += p.duration();
+  }
+  return last_end > first_start
+             ? static_cast<double>(busy) / (last_end - first_start)
+             : 0;
+}
+
+/**
+ * @brief Submits \p count independent busy kernels and \p host_tasks sleeping
+ *        host tasks, then reports the achieved concurrency
+ */
+void run_independent(sycl::queue& queue, uint64_t iterations,
+                     double single_kernel_us, size_t count, size_t host_tasks,
+                     const std::string& name) {
+  const bool profiling =
+      queue.has_property<sycl::property::queue::enable_profiling>();
+  uint32_t* out = sycl::malloc_device<uint32_t>(count, queue);
+  REQUIRE(out != nullptr);
+
+  std::vector<sycl::event> events;
+  const double makespan_us = performance::time_us([&] {
+    for (size_t i = 0; i < count; ++i) {
+      events.push_back(submit_busy_kernel(queue, iterations, out + i));
+      if (i < host_tasks) {
+        queue.submit([&](sycl::handler& cgh) {
+          cgh.host_task([] { std::this_thread::sleep_for(command_duration); });
+        });
+      }
+    }
+    queue.wait_and_throw();
+  });
+
+  std::vector<uint32_t> results(count);
+  queue.copy(out, results.data(), count).wait_and_throw();
+  sycl::free(out, queue);
+  const uint32_t expected = busy_kernel_result(iterations);
+  CHECK(std::all_of(results.begin(), results.end(),
+                    [=](uint32_t r) { return r == expected; }));
+
+  // Serial execution of all commands would take this long
+  const double host_task_us =
+      std::chrono::duration<double, std::micro>(command_duration).count();
+  const double serial_us = count * single_kernel_us + host_tasks * host_task_us;
+
+  performance::result res("queue", name + ", " + std::to_string(count) +
+                                       " kernels, " +
+                                       std::to_string(host_tasks) +
+                                       " host tasks");
+  res.with("makespan", makespan_us, "us")
+      .with("concurrency", makespan_us > 0 ? serial_us / makespan_us : 0, "x");
+  if (profiling)
+    res.with("profiled kernel concurrency", profiled_concurrency(events), "x");
+  res.record();
+}
+
+TEST_CASE("Concurrency of independent commands on out-of-order queues",
+          "[queue][performance]") {
+  auto default_queue = util::get_cts_object::queue();
+  const auto context = default_queue.get_context();
+  const auto device = default_queue.get_device();
+  const bool has_profiling = device.has(sycl::aspect::queue_profiling);
+
+  namespace props = sycl::property::queue;
+  const sycl::property_list out_of_order_props =
+      has_profiling ? sycl::property_list{props::enable_profiling()}
+                    : sycl::property_list{};
+  const sycl::property_list in_order_props =
+      has_profiling
+          ? sycl::property_list{props::in_order(), props::enable_profiling()}
+          : sycl::property_list{props::in_order()};
+  sycl::queue out_of_order{context, device, out_of_order_props};
+  sycl::queue in_order{context, device, in_order_props};
+
+  uint32_t* scratch = sycl::malloc_device<uint32_t>(1, out_of_order);
+  REQUIRE(scratch != nullptr);
+  const uint64_t iterations =
+      calibrate_busy_kernel(out_of_order, scratch, command_duration);
+  const auto single = performance::measure([&] {
+    submit_busy_kernel(out_of_order, iterations, scratch).wait_and_throw();
+  });
+  sycl::free(scratch, out_of_order);
+
+  for (const size_t count : independent_counts) {
+    run_independent(out_of_order, iterations, single.median, count, 0,
+                    "out-of-order queue");
+    run_independent(out_of_order, iterations, single.median, count, count,
+                    "out-of-order queue");
+    // Reference without any concurrency
+    run_independent(in_order, iterations, single.median, count, 0,
+                    "in-order queue");
+  }
+}
+
+}  // namespace queue_concurrency::tests
@@ -0,0 +1,49 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "queue_multithread.h"
+
+namespace queue_multithread::tests {
+
+constexpr size_t stress_commands = 1000;
+
+TEST_CASE("Concurrent submission from many threads", "[queue]") {
+  auto queue = sycl_cts::util::get_cts_object::queue();
+  const bool has_usm =
+      queue.get_device().has(sycl::aspect::usm_device_allocations);
+
+  for (const auto sharing :
+       {queue_sharing::shared, queue_sharing::per_thread}) {
+    for (const size_t threads : thread_counts()) {
+      INFO(to_string(sharing) << ", " << threads << " threads");
+      auto queues = make_queues(queue, sharing, threads);
+
+      // Buffers with overlapping accessors
+      verify_buffer_stress(run_buffer_stress(queues, threads, stress_commands),
+                           threads, stress_commands);
+      // USM with event dependencies
+      if (has_usm)
+        verify_usm_stress(run_usm_stress(queues, threads, stress_commands),
+                          threads, stress_commands);
+    }
+  }
+}
+
+}  // namespace queue_multithread::tests
@@ -0,0 +1,227 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Concurrent submission from many host threads to shared and per-thread
+//  queues
+//
+*******************************************************************************/
+
+#ifndef SYCL_CTS_QUEUE_QUEUE_MULTITHREAD_H
+#define SYCL_CTS_QUEUE_QUEUE_MULTITHREAD_H
+
+#include "../common/common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace queue_multithread {
+
+enum class queue_sharing { shared, per_thread };
+
+inline const char* to_string(queue_sharing sharing) {
+  return sharing == queue_sharing::shared ? "shared queue"
+                                          : "per-thread queues";
+}
+
+/**
+ * @brief Thread counts from 1 to the number of hardware threads, doubling
+ */
+inline std::vector<size_t> thread_counts() {
+  const size_t max_threads =
+      std::max<size_t>(1, std::thread::hardware_concurrency());
+  std::vector<size_t> counts;
+  for (size_t n = 1; n < max_threads; n *= 2) counts.push_back(n);
+  counts.push_back(max_threads);
+  return counts;
+}
+
+/**
+ * @brief Returns the queues used by \p threads threads, all in the context of
+ *        \p queue
+ */
+inline std::vector<sycl::queue> make_queues(sycl::queue& queue,
+                                            queue_sharing sharing,
+                                            size_t threads) {
+  if (sharing == queue_sharing::shared) return {queue};
+  std::vector<sycl::queue> queues;
+  for (size_t i = 0; i < threads; ++i)
+    queues.emplace_back(queue.get_context(), queue.get_device());
+  return queues;
+}
+
+/**
+ * @brief Runs \p body(thread_index, queue) on \p threads threads, thread t
+ *        using queues[t % queues.size()], and rethrows the first exception of
+ *        any of them after all have joined
+ * @details Catch2 assertions are not thread-safe, so \p body must not use
+ *          them.
+ */
+template <typename BodyT>
+void run_threads(std::vector<sycl::queue>& queues, size_t threads,
+                 BodyT&& body) {
+  std::vector<std::exception_ptr> errors(threads);
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t] {
+      try {
+        body(t, queues[t % queues.size()]);
+      } catch (...) {
+        errors[t] = std::current_exception();
+      }
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  for (const auto& error : errors)
+    if (error) std::rethrow_exception(error);
+}
+
+/**
+ * @brief Records when each thread starts and finishes submitting its commands
+ * @details Every thread only writes its own entries, so no synchronization
+ *          is needed.
+ */
+class submission_timer {
+ public:
+  using clock = std::chrono::steady_clock;
+
+  explicit submission_timer(size_t threads)
+      : m_begin(threads), m_end(threads) {}
+
+  void begin(size_t thread) { m_begin[thread] = clock::now(); }
+  void end(size_t thread) { m_end[thread] = clock::now(); }
+
+  /**
+   * @brief Time from the first thread starting to the last thread finishing
+   *        its submission in microseconds
+   */
+  double span_us() const {
+    const auto first = *std::min_element(m_begin.begin(), m_begin.end());
+    const auto last = *std::max_element(m_end.begin(), m_end.end());
+    return std::chrono::duration<double, std::micro>(last - first).count();
+  }
+
+ private:
+  std::vector<clock::time_point> m_begin;
+  std::vector<clock::time_point> m_end;
+};
+
+/**
+ * @brief Every thread submits \p commands command groups, all of which access
+ *        one buffer shared by all threads
+ * @details Each command increments the element of its thread and the last,
+ *          common element. The accessors overlap, so the runtime has to order
+ *          all commands and the increments do not need to be atomic.
+ * @param timer Records the submit loop of every thread if not null
+ * @return Counts of all threads followed by the total
+ */
+inline std::vector<uint32_t> run_buffer_stress(
+    std::vector<sycl::queue>& queues, size_t threads, size_t commands,
+    submission_timer* timer = nullptr) {
+  std::vector<uint32_t> counts(threads + 1, 0);
+  {
+    sycl::buffer<uint32_t, 1> buf(counts.data(), sycl::range<1>(threads + 1));
+    run_threads(queues, threads, [&](size_t t, sycl::queue& q) {
+      if (timer) timer->begin(t);
+      for (size_t i = 0; i < commands; ++i) {
+        q.submit([&](sycl::handler& cgh) {
+          sycl::accessor acc{buf, cgh, sycl::read_write};
+          cgh.single_task([=] {
+            ++acc[t];
+            ++acc[threads];
+          });
+        });
+      }
+      if (timer) timer->end(t);
+    });
+  }
+  return counts;
+}
+
+/**
+ * @brief Every thread runs a chain of \p commands kernels over its own USM
+ *        allocation, each depending on the event of the previous one
+ * @details Each kernel checks that its predecessor has completed by comparing
+ *          the counter with its own index.
+ * @param timer Records the submit loop of every thread if not null
+ * @return For every thread, the final counter and the number of kernels which
+ *         observed a wrong counter
+ */
+inline std::vector<uint32_t> run_usm_stress(std::vector<sycl::queue>& queues,
+                                            size_t threads, size_t commands,
+                                            submission_timer* timer = nullptr) {
+  sycl::queue& alloc_queue = queues.front();
+  uint32_t* state = sycl::malloc_device<uint32_t>(2 * threads, alloc_queue);
+  if (state == nullptr) throw std::bad_alloc();
+  alloc_queue.fill(state, uint32_t{0}, 2 * threads).wait_and_throw();
+
+  run_threads(queues, threads, [&](size_t t, sycl::queue& q) {
+    uint32_t* counter = state + 2 * t;
+    uint32_t* wrong = counter + 1;
+    sycl::event previous;
+    if (timer) timer->begin(t);
+    for (uint32_t i = 0; i < commands; ++i) {
+      previous = q.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(previous);
+        cgh.single_task([=] {
+          if (*counter != i) ++*wrong;
+          *counter = i + 1;
+        });
+      });
+    }
+    if (timer) timer->end(t);
+    previous.wait_and_throw();
+  });
+
+  std::vector<uint32_t> result(2 * threads);
+  alloc_queue.copy(state, result.data(), result.size()).wait_and_throw();
+  sycl::free(state, alloc_queue);
+  return result;
+}
+
+/**
+ * @brief Checks the results of run_buffer_stress()
+ */
+inline void verify_buffer_stress(const std::vector<uint32_t>& counts,
+                                 size_t threads, size_t commands) {
+  for (size_t t = 0; t < threads; ++t) {
+    INFO("thread " << t);
+    CHECK(counts[t] == commands);
+  }
+  CHECK(counts[threads] == threads * commands);
+}
+
+/**
+ * @brief Checks the results of run_usm_stress()
+ */
+inline void verify_usm_stress(const std::vector<uint32_t>& state,
+                              size_t threads, size_t commands) {
+  for (size_t t = 0; t < threads; ++t) {
+    INFO("thread " << t);
+    CHECK(state[2 * t] == commands);
+    CHECK(state[2 * t + 1] == 0);
+  }
+}
+
+}  // namespace queue_multithread
+
+#endif  // SYCL_CTS_QUEUE_QUEUE_MULTITHREAD_H
@@ -0,0 +1,115 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "../common/performance.h"
+#include "queue_multithread.h"
+
+#include <utility>
+#include <vector>
+
+namespace queue_multithread::tests {
+using namespace sycl_cts;
+
+constexpr size_t throughput_commands = 10000;
+// Runs per thread count, the warm-up runs are not measured
+constexpr size_t warmup_runs = 1;
+constexpr size_t measured_runs = 3;
+
+/**
+ * @brief Submission span and completion time of repeated calls of \p run
+ * @param run Called with a submission_timer, returns the data to verify
+ * @param verify Called with the data returned by the last run
+ */
+template <typename RunT, typename VerifyT>
+std::pair<performance::timing, performance::timing> measure_stress(
+    size_t threads, RunT&& run, VerifyT&& verify) {
+  std::vector<double> submission_us;
+  std::vector<uint32_t> data;
+  const auto completion = performance::measure(
+      [&] {
+        submission_timer timer(threads);
+        data = run(timer);
+        submission_us.push_back(timer.span_us());
+      },
+      measured_runs, warmup_runs);
+  // measure() calls the functor for the warm-up runs first
+  submission_us.erase(submission_us.begin(),
+                      submission_us.begin() + warmup_runs);
+  verify(data);
+  return {performance::summarize(std::move(submission_us)), completion};
+}
+
+TEST_CASE("Aggregate submission throughput by host thread count",
+          "[queue][performance]") {
+  auto queue = util::get_cts_object::queue();
+  const bool has_usm =
+      queue.get_device().has(sycl::aspect::usm_device_allocations);
+
+  for (const auto sharing :
+       {queue_sharing::shared, queue_sharing::per_thread}) {
+    for (const size_t threads : thread_counts()) {
+      auto queues = make_queues(queue, sharing, threads);
+      const size_t total = threads * throughput_commands;
+      // Commands per microsecond are millions of commands per second
+      const auto per_second = [=](double us) {
+        return us > 0 ? total / us : 0.0;
+      };
+
+      // Submission covers only the submit loops of the threads, completion
+      // also the setup, the execution of all commands and the write-back
+      const auto [buffer_submit, buffer_total] = measure_stress(
+          threads,
+          [&](submission_timer& timer) {
+            return run_buffer_stress(queues, threads, throughput_commands,
+                                     &timer);
+          },
+          [&](const std::vector<uint32_t>& counts) {
+            verify_buffer_stress(counts, threads, throughput_commands);
+          });
+
+      performance::result res(
+          "queue", std::string(to_string(sharing)) + ", " +
+                       std::to_string(threads) + " threads");
+      res.with("buffers submission", buffer_submit)
+          .with("buffers submission throughput",
+                per_second(buffer_submit.median), "Mcommands/s")
+          .with("buffers completion", buffer_total);
+
+      if (has_usm) {
+        const auto [usm_submit, usm_total] = measure_stress(
+            threads,
+            [&](submission_timer& timer) {
+              return run_usm_stress(queues, threads, throughput_commands,
+                                    &timer);
+            },
+            [&](const std::vector<uint32_t>& state) {
+              verify_usm_stress(state, threads, throughput_commands);
+            });
+        res.with("USM submission", usm_submit)
+            .with("USM submission throughput", per_second(usm_submit.median),
+                  "Mcommands/s")
+            .with("USM completion", usm_total);
+      }
+      res.record();
+    }
+  }
+}
+
+}  // namespace queue_multithread::tests
@@ -0,0 +1,148 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Measures submission latency of kernels using specialization constants
+//  when their values change between submissions, to show whether the
+//  implementation caches specialized executables per value set
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+#include "../common/failure_recorder.h"
+#include "../common/performance.h"
+#include "spec_constants_defined_various_ways_helper.h"
+
+#include <vector>
+
+namespace specialization_constants_cache_perf {
+using namespace sycl_cts;
+namespace sch = spec_const_help;
+
+constexpr int distinct_values = 8;
+constexpr size_t repetitions = 20;
+
+template <int case_num>
+class kernel_sc_cache;
+
+/**
+ * @brief Measures the latency of submitting a kernel reading \p SpecConst and
+ *        waiting for it:
+ *        - the very first submission, which has to build the kernel;
+ *        - repeated submissions with the same value;
+ *        - a pass over distinct_values new values, each a potential cache
+ *          miss;
+ *        - a second pass over the same values, which a cache holding
+ *          distinct_values specialized executables serves without rebuilds;
+ *        - submissions alternating between two values.
+ */
+template <int case_num, auto& SpecConst>
+void measure_spec_const_cache(sycl::queue& queue, int* out,
+                              const std::string& case_hint) {
+  const auto value = [](int i) { return 1000 * case_num + i; };
+  const auto submit = [&](int i) {
+    queue
+        .submit([&](sycl::handler& cgh) {
+          cgh.set_specialization_constant<SpecConst>(value(i));
+          cgh.single_task<kernel_sc_cache<case_num>>(
+              [=](sycl::kernel_handler h) {
+                out[i] = h.get_specialization_constant<SpecConst>();
+              });
+        })
+        .wait_and_throw();
+  };
+  const auto cycle = [&] {
+    std::vector<double> samples_us;
+    for (int i = 1; i <= distinct_values; ++i)
+      samples_us.push_back(performance::time_us([&] { submit(i); }));
+    return performance::summarize(std::move(samples_us));
+  };
+
+  const double first_run = performance::time_us([&] { submit(0); });
+  const auto cached =
+      performance::measure([&] { submit(0); }, repetitions, 0);
+  const auto cache_miss = cycle();
+  const auto revisit = cycle();
+  int alternate = 0;
+  const auto alternating = performance::measure(
+      [&] {
+        submit(1 + alternate);
+        alternate = 1 - alternate;
+      },
+      repetitions, 0);
+
+  std::vector<int> result(distinct_values + 1);
+  queue.copy(out, result.data(), result.size()).wait_and_throw();
+  failure_recorder<int> failures;
+  for (int i = 0; i <= distinct_values; ++i)
+    failures.check_equal("spec constant value", i, result[i], value(i));
+  failures.report(case_hint);
+
+  performance::result("spec_constants cache", case_hint)
+      .with("first run", first_run, "us")
+      .with("cached", cached)
+      .with("cache miss", cache_miss)
+      .with("cycle revisit", revisit)
+      .with("alternating values", alternating)
+      .record();
+}
+
+TEST_CASE("Specialization constant executable cache latency",
+          "[spec_constants][performance]") {
+  auto queue = util::get_cts_object::queue();
+  int* out = sycl::malloc_device<int>(distinct_values + 1, queue);
+  REQUIRE(out != nullptr);
+
+  // Each specialization constant is used by its own kernel, so every first
+  // run needs a build
+  {
+    constexpr int case_num = to_integral(sch::sc_vw_id::nonglob);
+    measure_spec_const_cache<case_num, sch::sc_nonglob<int, case_num>>(
+        queue, out, sch::get_hint(sch::sc_vw_id::nonglob));
+  }
+  {
+    constexpr int case_num = to_integral(sch::sc_vw_id::unnamed);
+    measure_spec_const_cache<case_num, sc_unnamed<int, case_num>>(
+        queue, out, sch::get_hint(sch::sc_vw_id::unnamed));
+  }
+  {
+    constexpr int case_num = to_integral(sch::sc_vw_id::glob_inl);
+    measure_spec_const_cache<case_num, sc_glob_inl<int, case_num>>(
+        queue, out, sch::get_hint(sch::sc_vw_id::glob_inl));
+  }
+  {
+    constexpr int case_num = to_integral(sch::sc_vw_id::glob_static);
+    measure_spec_const_cache<case_num, sc_glob_static<int, case_num>>(
+        queue, out, sch::get_hint(sch::sc_vw_id::glob_static));
+  }
+  {
+    constexpr int case_num = to_integral(sch::sc_vw_id::str_glob);
+    measure_spec_const_cache<case_num, struct_glob::sc<int, case_num>>(
+        queue, out, sch::get_hint(sch::sc_vw_id::str_glob));
+  }
+  {
+    constexpr int case_num = to_integral(sch::sc_vw_id::str_nonglob);
+    measure_spec_const_cache<case_num, sch::struct_nonglob::sc<int, case_num>>(
+        queue, out, sch::get_hint(sch::sc_vw_id::str_nonglob));
+  }
+  {
+    constexpr int case_num = to_integral(sch::sc_vw_id::str_unnamed);
+    measure_spec_const_cache<case_num, struct_unnamed::sc<int, case_num>>(
+        queue, out, sch::get_hint(sch::sc_vw_id::str_unnamed));
+  }
+  {
+    constexpr int case_num = to_integral(sch::sc_vw_id::str_glob_inl);
+    measure_spec_const_cache<case_num, struct_glob_inl::sc<int, case_num>>(
+        queue, out, sch::get_hint(sch::sc_vw_id::str_glob_inl));
+  }
+  {
+    constexpr int case_num = to_integral(sch::sc_vw_id::str_glob_tmpl);
+    measure_spec_const_cache<case_num,
+                             struct_glob_tmpl<int>::template sc<case_num>>(
+        queue, out, sch::get_hint(sch::sc_vw_id::str_glob_tmpl));
+  }
+
+  sycl::free(out, queue);
+}
+
+}  // namespace specialization_constants_cache_perf
@@ -0,0 +1,278 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures USM allocation and free latency across kinds, sizes, alignments,
+//  churn and concurrent threads, and looks for signs of allocation pooling
+//
+*******************************************************************************/
+
+#include "../../util/usm_helper.h"
+#include "../common/common.h"
+#include "../common/performance.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace usm_allocation_latency_perf {
+using namespace sycl_cts;
+
+constexpr sycl::usm::alloc kinds[] = {
+    sycl::usm::alloc::device, sycl::usm::alloc::host, sycl::usm::alloc::shared};
+
+constexpr size_t sizes[] = {1,       64,       4 << 10,   64 << 10,
+                            1 << 20, 16 << 20, 256 << 20, size_t{1} << 30};
+constexpr size_t alignments[] = {64, 4 << 10, 64 << 10, 2 << 20};
+constexpr size_t aligned_size = 1 << 20;
+
+// Allocations kept alive at the same time for the cold measurement, so every
+// one of them needs fresh memory; large sizes use fewer of them, so all live
+// blocks together stay within a quarter of the global memory
+constexpr size_t max_cold_allocations = 16;
+constexpr uint64_t cold_budget_divisor = 4;
+// Alloc/free pairs of the churn measurement for small and large sizes
+constexpr size_t churn_iterations = 1000;
+constexpr size_t large_churn_iterations = 20;
+constexpr size_t large_size = 16 << 20;
+
+constexpr size_t thread_churn_iterations = 1000;
+constexpr size_t thread_churn_size = 4 << 10;
+
+inline sycl::aspect aspect_of(sycl::usm::alloc kind) {
+  switch (kind) {
+    case sycl::usm::alloc::device:
+      return usm_helper::get_aspect<sycl::usm::alloc::device>();
+    case sycl::usm::alloc::host:
+      return usm_helper::get_aspect<sycl::usm::alloc::host>();
+    default:
+      return usm_helper::get_aspect<sycl::usm::alloc::shared>();
+  }
+}
+
+inline std::string name_of(sycl::usm::alloc kind) {
+  switch (kind) {
+    case sycl::usm::alloc::device:
+      return "device";
+    case sycl::usm::alloc::host:
+      return "host";
+    default:
+      return "shared";
+  }
+}
+
+/**
+ * @brief Number of cold allocations of \p size bytes that fit the budget
+ */
+inline size_t cold_allocations(const sycl::device& device, size_t size) {
+  const uint64_t budget =
+      device.get_info<sycl::info::device::global_mem_size>() /
+      cold_budget_divisor;
+  return static_cast<size_t>(
+      std::clamp<uint64_t>(budget / size, 1, max_cold_allocations));
+}
+
+/**
+ * @brief Allocates with the given alignment, 0 meaning sycl::malloc
+ */
+inline void* allocate(sycl::queue& queue, size_t size, size_t alignment,
+                      sycl::usm::alloc kind) {
+  return alignment == 0 ? sycl::malloc(size, queue, kind)
+                        : sycl::aligned_alloc(alignment, size, queue, kind);
+}
+
+/**
+ * @brief Latencies of a single size and alignment and whether freed memory
+ *        was handed out again right away
+ */
+struct latency {
+  performance::timing cold_alloc;
+  performance::timing cold_free;
+  performance::timing churn;
+  // Fraction of churn allocations that returned the block just freed
+  double reuse = 0;
+};
+
+/**
+ * @brief Measures cold allocations, their frees and alloc/free churn, and
+ *        checks kind and alignment of every allocation
+ * @return false if the device could not provide the memory
+ */
+bool measure_latency(sycl::queue& queue, sycl::usm::alloc kind, size_t size,
+                     size_t alignment, latency& result) {
+  const auto ctx = queue.get_context();
+  size_t wrong_kind = 0;
+  size_t misaligned = 0;
+  const auto check = [&](void* ptr) {
+    wrong_kind += sycl::get_pointer_type(ptr, ctx) != kind;
+    if (alignment != 0)
+      misaligned += reinterpret_cast<uintptr_t>(ptr) % alignment != 0;
+  };
+
+  std::vector<double> alloc_us;
+  std::vector<double> free_us;
+  std::vector<void*> live(cold_allocations(queue.get_device(), size),
+                          nullptr);
+  for (auto& ptr : live) {
+    alloc_us.push_back(performance::time_us(
+        [&] { ptr = allocate(queue, size, alignment, kind); }));
+    if (ptr == nullptr) break;
+    check(ptr);
+  }
+  const bool complete = std::all_of(live.begin(), live.end(),
+                                    [](void* ptr) { return ptr != nullptr; });
+  for (void* ptr : live) {
+    if (ptr == nullptr) continue;
+    free_us.push_back(performance::time_us([&] { sycl::free(ptr, ctx); }));
+  }
+  if (!complete) return false;
+
+  const size_t iterations =
+      size >= large_size ? large_churn_iterations : churn_iterations;
+  void* previous = nullptr;
+  size_t reused = 0;
+  std::vector<double> churn_us;
+  for (size_t i = 0; i < iterations; ++i) {
+    void* ptr = nullptr;
+    churn_us.push_back(performance::time_us([&] {
+      ptr = allocate(queue, size, alignment, kind);
+      if (ptr != nullptr) sycl::free(ptr, ctx);
+    }));
+    if (ptr == nullptr) return false;
+    reused += ptr == previous;
+    previous = ptr;
+  }
+
+  CHECK(wrong_kind == 0);
+  CHECK(misaligned == 0);
+  result.cold_alloc = performance::summarize(alloc_us);
+  result.cold_free = performance::summarize(free_us);
+  result.churn = performance::summarize(churn_us);
+  result.reuse = iterations > 1 ? static_cast<double>(reused) / (iterations - 1)
+                                : 0;
+  return true;
+}
+
+void record_latency(const std::string& name, const latency& l) {
+  // A runtime that pools allocations serves churn from its cache, which is
+  // much faster than a cold allocation, and hands out the same block again
+  const double speedup =
+      l.churn.median > 0
+          ? (l.cold_alloc.median + l.cold_free.median) / l.churn.median
+          : 0;
+  performance::result("usm", name)
+      .with("cold alloc", l.cold_alloc)
+      .with("cold free", l.cold_free)
+      .with("churn alloc + free", l.churn)
+      .with("churn speedup", speedup, "x")
+      .with("address reuse", 100 * l.reuse, "%")
+      .record();
+}
+
+TEST_CASE("USM allocation latency by kind and size", "[usm][performance]") {
+  auto queue = util::get_cts_object::queue();
+  const uint64_t max_alloc =
+      queue.get_device().get_info<sycl::info::device::max_mem_alloc_size>();
+
+  for (const auto kind : kinds) {
+    if (!queue.get_device().has(aspect_of(kind))) continue;
+    for (const size_t size : sizes) {
+      const std::string name =
+          name_of(kind) + ", " + std::to_string(size) + " bytes";
+      if (size > max_alloc) {
+        WARN(name << " exceeds max_mem_alloc_size, skipped");
+        continue;
+      }
+      latency l;
+      if (!measure_latency(queue, kind, size, 0, l)) {
+        WARN(name << " could not be allocated "
+                  << cold_allocations(queue.get_device(), size)
+                  << " times, skipped");
+        continue;
+      }
+      record_latency(name, l);
+    }
+  }
+}
+
+TEST_CASE("USM aligned allocation latency by alignment",
+          "[usm][performance]") {
+  auto queue = util::get_cts_object::queue();
+
+  for (const auto kind : kinds) {
+    if (!queue.get_device().has(aspect_of(kind))) continue;
+    for (const size_t alignment : alignments) {
+      const std::string name = name_of(kind) + ", " +
+                               std::to_string(aligned_size) +
+                               " bytes aligned to " + std::to_string(alignment);
+      latency l;
+      if (!measure_latency(queue, kind, aligned_size, alignment, l)) {
+        WARN(name << " could not be allocated, skipped");
+        continue;
+      }
+      record_latency(name, l);
+    }
+  }
+}
+
+TEST_CASE("USM allocation churn with concurrent threads",
+          "[usm][performance]") {
+  auto queue = util::get_cts_object::queue();
+  const auto ctx = queue.get_context();
+  const size_t max_threads =
+      std::max<size_t>(1, std::thread::hardware_concurrency());
+
+  for (const auto kind : kinds) {
+    if (!queue.get_device().has(aspect_of(kind))) continue;
+    for (size_t threads = 1;; threads = std::min(threads * 2, max_threads)) {
+      std::atomic<size_t> failed{0};
+      std::atomic<size_t> wrong_kind{0};
+      const double us = performance::time_us([&] {
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+          workers.emplace_back([&] {
+            for (size_t i = 0; i < thread_churn_iterations; ++i) {
+              void* ptr = sycl::malloc(thread_churn_size, queue, kind);
+              if (ptr == nullptr) {
+                ++failed;
+                continue;
+              }
+              wrong_kind += sycl::get_pointer_type(ptr, ctx) != kind;
+              sycl::free(ptr, ctx);
+            }
+          });
+        }
+        for (auto& worker : workers) worker.join();
+      });
+      CHECK(failed == 0);
+      CHECK(wrong_kind == 0);
+
+      const size_t ops = threads * thread_churn_iterations;
+      performance::result("usm", name_of(kind) + ", " +
+                                     std::to_string(threads) + " threads")
+          .with("churn", us, "us")
+          .with("throughput", us > 0 ? ops / us : 0, "Mallocs/s")
+          .record();
+      if (threads == max_threads) break;
+    }
+  }
+}
+
+}  // namespace usm_allocation_latency_perf
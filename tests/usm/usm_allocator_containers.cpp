@@ -0,0 +1,115 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides tests for std::vector backed by sycl::usm_allocator at scale
+//
+*******************************************************************************/
+
+#include "usm_allocator_containers.h"
+
+namespace usm_allocator_containers_test {
+using namespace usm_allocator_containers;
+
+enum class step : int { growth, shrink, copy_ctor, copy_assign, move_assign };
+
+template <sycl::usm::alloc kind, step s>
+class verify_kernel;
+
+constexpr size_t grow_size = size_t{1} << 22;
+
+/** @brief Verifies \p vec on a queue of whichever context owns its storage
+ */
+template <sycl::usm::alloc kind, step s>
+void verify(const usm_vector<kind>& vec, std::vector<sycl::queue>& queues,
+            value_type seed) {
+  std::vector<sycl::context> contexts;
+  for (auto& q : queues) contexts.push_back(q.get_context());
+
+  const size_t owner = owning_context(vec.data(), contexts);
+  REQUIRE(owner < contexts.size());
+  CHECK(sycl::get_pointer_type(vec.data(), contexts[owner]) == kind);
+  CHECK(count_mismatches<verify_kernel<kind, s>>(queues[owner], vec.data(),
+                                                 vec.size(), seed) == 0);
+}
+
+template <sycl::usm::alloc kind>
+void run_for_kind() {
+  using allocator = sycl::usm_allocator<value_type, kind>;
+  auto queue = util::get_cts_object::queue();
+  const auto device = queue.get_device();
+  const std::string kind_name(usm_helper::get_allocation_description<kind>());
+  if (!device.has(usm_helper::get_aspect<kind>())) {
+    WARN("Device does not support " << kind_name << " allocations, skipped");
+    return;
+  }
+  INFO("kind: " << kind_name);
+
+  // A second context on the same device, so allocators compare unequal
+  sycl::queue other_queue(sycl::context(device), device);
+  std::vector<sycl::queue> queues{queue, other_queue};
+
+  usm_vector<kind> vec{allocator(queue)};
+  const growth_stats stats = grow(vec, grow_size, 1);
+  REQUIRE(vec.size() == grow_size);
+  CHECK(stats.allocations > 1);
+  CHECK(stats.final_capacity >= grow_size);
+  verify<kind, step::growth>(vec, queues, 1);
+  CHECK(owning_context(vec.data(), {queue.get_context()}) == 0);
+
+  vec.resize(grow_size / 2);
+  vec.shrink_to_fit();
+  REQUIRE(vec.size() == grow_size / 2);
+  CHECK(vec.capacity() >= vec.size());
+  verify<kind, step::shrink>(vec, queues, 1);
+
+  // Allocator-extended copy always allocates from the given allocator
+  usm_vector<kind> copy(vec, allocator(other_queue));
+  REQUIRE(copy.size() == vec.size());
+  CHECK(owning_context(copy.data(), {other_queue.get_context()}) == 0);
+  verify<kind, step::copy_ctor>(copy, queues, 1);
+
+  // usm_allocator propagates on copy and move assignment, so the targets end
+  // up with the allocator of the source, bound to the context of queue
+  usm_vector<kind> assigned{allocator(other_queue)};
+  grow(assigned, 1000, 2);
+  assigned = vec;
+  REQUIRE(assigned.size() == vec.size());
+  CHECK(assigned.get_allocator() == allocator(queue));
+  CHECK(owning_context(assigned.data(), {queue.get_context()}) == 0);
+  verify<kind, step::copy_assign>(assigned, queues, 1);
+  verify<kind, step::growth>(vec, queues, 1);
+
+  // With the allocator propagated, the storage is taken over from the source
+  const value_type* source_data = vec.data();
+  usm_vector<kind> moved{allocator(other_queue)};
+  grow(moved, 1000, 3);
+  moved = std::move(vec);
+  REQUIRE(moved.size() == grow_size / 2);
+  CHECK(moved.get_allocator() == allocator(queue));
+  CHECK(moved.data() == source_data);
+  CHECK(owning_context(moved.data(), {queue.get_context()}) == 0);
+  verify<kind, step::move_assign>(moved, queues, 1);
+}
+
+TEST_CASE("std::vector with usm_allocator growth, shrink, copy and move",
+          "[usm]") {
+  run_for_kind<sycl::usm::alloc::host>();
+  run_for_kind<sycl::usm::alloc::shared>();
+}
+
+}  // namespace usm_allocator_containers_test
@@ -0,0 +1,114 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Common helpers for std::vector backed by sycl::usm_allocator
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_USM_ALLOCATOR_CONTAINERS_H
+#define __SYCLCTS_TESTS_USM_ALLOCATOR_CONTAINERS_H
+
+#include "../../util/usm_helper.h"
+#include "../common/common.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace usm_allocator_containers {
+using namespace sycl_cts;
+
+using value_type = uint32_t;
+
+/** @brief std::vector under test; usm_allocator does not support device
+ *         allocations, so only host and shared kinds are used
+ */
+template <sycl::usm::alloc kind>
+using usm_vector =
+    std::vector<value_type, sycl::usm_allocator<value_type, kind>>;
+
+/** @brief Value expected at \p index after a step identified by \p seed
+ */
+inline value_type value_at(size_t index, value_type seed) {
+  return static_cast<value_type>(index) * 3u + seed;
+}
+
+/** @brief Number of buffer (re)allocations observed while growing a vector
+ */
+struct growth_stats {
+  size_t allocations = 0;
+  size_t final_capacity = 0;
+};
+
+/** @brief Grows \p vec to \p count elements by push_back and counts the
+ *         allocations as changes of data()
+ */
+template <typename VectorT>
+growth_stats grow(VectorT& vec, size_t count, value_type seed) {
+  growth_stats stats;
+  const value_type* data = vec.data();
+  for (size_t i = vec.size(); i < count; ++i) {
+    vec.push_back(value_at(i, seed));
+    if (vec.data() != data) {
+      data = vec.data();
+      ++stats.allocations;
+    }
+  }
+  stats.final_capacity = vec.capacity();
+  return stats;
+}
+
+/** @brief Counts elements of \p data differing from value_at(i, seed) with a
+ *         kernel on \p queue, which must share the context of the allocation
+ */
+template <typename KernelName>
+size_t count_mismatches(sycl::queue& queue, const value_type* data,
+                        size_t count, value_type seed) {
+  uint32_t mismatches = 0;
+  {
+    sycl::buffer<uint32_t> mismatch_buf(&mismatches, sycl::range<1>(1));
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc(mismatch_buf, cgh, sycl::read_write);
+      cgh.parallel_for<KernelName>(sycl::range<1>(count), [=](sycl::id<1> i) {
+        if (data[i] != static_cast<value_type>(i[0]) * 3u + seed) {
+          sycl::atomic_ref<uint32_t, sycl::memory_order::relaxed,
+                           sycl::memory_scope::device,
+                           sycl::access::address_space::global_space>(acc[0])
+              .fetch_add(1u);
+        }
+      });
+    });
+  }
+  return mismatches;
+}
+
+/** @brief Context owning the allocation at \p ptr, out of \p contexts
+ * @return Index into \p contexts, or contexts.size() if none owns it
+ */
+inline size_t owning_context(const void* ptr,
+                             const std::vector<sycl::context>& contexts) {
+  for (size_t i = 0; i < contexts.size(); ++i) {
+    if (sycl::get_pointer_type(ptr, contexts[i]) != sycl::usm::alloc::unknown)
+      return i;
+  }
+  return contexts.size();
+}
+
+}  // namespace usm_allocator_containers
+
+#endif  // __SYCLCTS_TESTS_USM_ALLOCATOR_CONTAINERS_H
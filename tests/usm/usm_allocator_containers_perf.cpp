@@ -0,0 +1,122 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures growth, shrink, copy and move of std::vector backed by
+//  sycl::usm_allocator against std::allocator
+//
+*******************************************************************************/
+
+#include "../common/performance.h"
+#include "usm_allocator_containers.h"
+
+#include <utility>
+#include <vector>
+
+namespace usm_allocator_containers_perf {
+using namespace usm_allocator_containers;
+
+template <sycl::usm::alloc kind>
+class verify_kernel;
+
+constexpr size_t sizes[] = {10'000, 100'000, 1'000'000, 10'000'000};
+// Move assignments measured, each from a freshly copied source
+constexpr size_t move_samples = 5;
+
+template <sycl::usm::alloc kind>
+void run_for_kind() {
+  using allocator = sycl::usm_allocator<value_type, kind>;
+  auto queue = util::get_cts_object::queue();
+  const auto device = queue.get_device();
+  const std::string kind_name(usm_helper::get_allocation_description<kind>());
+  if (!device.has(usm_helper::get_aspect<kind>())) {
+    WARN("Device does not support " << kind_name << " allocations, skipped");
+    return;
+  }
+  sycl::queue other_queue(sycl::context(device), device);
+
+  for (const size_t size : sizes) {
+    if (performance::limit_alloc_size(device, size * sizeof(value_type)) <
+        size * sizeof(value_type)) {
+      WARN(size << " elements exceed the allocation limit, skipped");
+      continue;
+    }
+    const std::string name = kind_name + ", " + std::to_string(size);
+    INFO(name);
+
+    growth_stats stats;
+    const auto growth = performance::measure([&] {
+      usm_vector<kind> vec{allocator(queue)};
+      stats = grow(vec, size, 1);
+    });
+    const auto reserved = performance::measure([&] {
+      usm_vector<kind> vec{allocator(queue)};
+      vec.reserve(size);
+      grow(vec, size, 1);
+    });
+    const auto baseline = performance::measure([&] {
+      std::vector<value_type> vec;
+      grow(vec, size, 1);
+    });
+
+    usm_vector<kind> vec{allocator(queue)};
+    grow(vec, size, 1);
+    CHECK(count_mismatches<verify_kernel<kind>>(queue, vec.data(), size, 1) ==
+          0);
+
+    const auto copy_same = performance::measure(
+        [&] { usm_vector<kind> copy(vec, allocator(queue)); });
+    const auto copy_other = performance::measure(
+        [&] { usm_vector<kind> copy(vec, allocator(other_queue)); });
+    // Only the assignment is timed, the source is prepared beforehand
+    std::vector<double> move_us;
+    for (size_t i = 0; i < move_samples; ++i) {
+      usm_vector<kind> source(vec, allocator(queue));
+      usm_vector<kind> target{allocator(other_queue)};
+      move_us.push_back(
+          performance::time_us([&] { target = std::move(source); }));
+      CHECK(target.size() == size);
+    }
+    const auto move = performance::summarize(std::move(move_us));
+    const auto shrink = performance::measure([&] {
+      usm_vector<kind> copy(vec, allocator(queue));
+      copy.resize(size / 2);
+      copy.shrink_to_fit();
+    });
+
+    performance::result("usm", "usm_allocator vector, " + name)
+        .with("push_back growth", growth)
+        .with("allocations", static_cast<double>(stats.allocations), "")
+        .with("reserve + push_back", reserved)
+        .with("std::allocator push_back", baseline)
+        .with("copy, same context", copy_same)
+        .with("copy, other context", copy_other)
+        .with("move assign, other context", move)
+        .with("copy + shrink_to_fit", shrink)
+        .with("growth vs std::allocator",
+              baseline.median > 0 ? growth.median / baseline.median : 0, "x")
+        .record();
+  }
+}
+
+TEST_CASE("std::vector with usm_allocator growth and copy cost",
+          "[usm][performance]") {
+  run_for_kind<sycl::usm::alloc::host>();
+  run_for_kind<sycl::usm::alloc::shared>();
+}
+
+}  // namespace usm_allocator_containers_perf
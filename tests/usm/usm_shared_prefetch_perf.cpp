@@ -0,0 +1,163 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures shared USM migration between host and device with and without
+//  a preceding prefetch
+//
+*******************************************************************************/
+
+#include "../../util/usm_helper.h"
+#include "../common/common.h"
+#include "../common/failure_recorder.h"
+#include "../common/performance.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace usm_shared_prefetch_perf {
+using namespace sycl_cts;
+
+class increment_kernel;
+class empty_kernel;
+
+constexpr size_t sizes[] = {1 << 20, 16 << 20, 256 << 20};
+// Host/device round trips per measurement
+constexpr size_t rounds = 5;
+// On CPU devices, prefetch taking longer than this many empty kernels is
+// reported, leaving room for timing noise
+constexpr double trivial_command_tolerance = 2;
+
+/**
+ * @brief Times of one round trip, each including the wait for its command
+ */
+struct round_times {
+  double prefetch_us = 0;
+  double kernel_us = 0;
+  // The same kernel again, with the data already resident on the device
+  double resident_us = 0;
+};
+
+sycl::event increment(sycl::queue& queue, uint32_t* data, size_t count) {
+  return queue.parallel_for<increment_kernel>(
+      sycl::range<1>(count), [=](sycl::id<1> i) { data[i] += 1; });
+}
+
+/**
+ * @brief Writes \p data on the host, runs the kernel twice on the device and
+ *        reads the result back on the host, so every round migrates the
+ *        region both ways
+ */
+round_times round_trip(sycl::queue& queue, uint32_t* data, size_t count,
+                       uint32_t seed, bool prefetch,
+                       failure_recorder<uint32_t>& failures) {
+  for (size_t i = 0; i < count; ++i) data[i] = static_cast<uint32_t>(i) + seed;
+
+  round_times t;
+  if (prefetch) {
+    t.prefetch_us = performance::time_us([&] {
+      queue.prefetch(data, count * sizeof(uint32_t)).wait_and_throw();
+    });
+  }
+  t.kernel_us = performance::time_us(
+      [&] { increment(queue, data, count).wait_and_throw(); });
+  t.resident_us = performance::time_us(
+      [&] { increment(queue, data, count).wait_and_throw(); });
+
+  for (size_t i = 0; i < count; ++i) {
+    failures.check_equal("round trip", i, data[i],
+                         static_cast<uint32_t>(i) + seed + 2);
+  }
+  return t;
+}
+
+TEST_CASE("Shared USM migration with and without prefetch",
+          "[usm][performance]") {
+  auto queue = util::get_cts_object::queue();
+  const auto device = queue.get_device();
+  if (!device.has(sycl::aspect::usm_shared_allocations)) {
+    SKIP("Device does not support shared allocations");
+  }
+  const bool is_cpu = device.is_cpu();
+  // Cost of a trivial command, the baseline for prefetch on CPU devices
+  const auto empty = performance::measure(
+      [&] { queue.single_task<empty_kernel>([] {}).wait_and_throw(); });
+
+  for (const size_t preferred : sizes) {
+    const size_t bytes = performance::limit_alloc_size(device, preferred);
+    const size_t count = bytes / sizeof(uint32_t);
+    auto data = usm_helper::allocate_usm_memory<sycl::usm::alloc::shared,
+                                                uint32_t>(queue, count);
+    const std::string name = std::to_string(bytes) + " bytes";
+
+    failure_recorder<uint32_t> failures;
+    std::vector<double> cold_us, prefetched_us, prefetch_us, resident_us;
+    // The first round also pays for the initial placement, so it is dropped
+    round_trip(queue, data.get(), count, 0, true, failures);
+    for (size_t r = 0; r < rounds; ++r) {
+      const auto cold =
+          round_trip(queue, data.get(), count, 2 * r, false, failures);
+      const auto warm =
+          round_trip(queue, data.get(), count, 2 * r + 1, true, failures);
+      cold_us.push_back(cold.kernel_us);
+      prefetched_us.push_back(warm.kernel_us);
+      prefetch_us.push_back(warm.prefetch_us);
+      resident_us.push_back(cold.resident_us);
+      resident_us.push_back(warm.resident_us);
+    }
+    failures.report(name);
+
+    const auto cold = performance::summarize(cold_us);
+    const auto prefetched = performance::summarize(prefetched_us);
+    const auto prefetch = performance::summarize(prefetch_us);
+    const auto resident = performance::summarize(resident_us);
+    // Whatever the kernel takes beyond the resident run is spent migrating
+    const double migration_us = cold.median - resident.median;
+    performance::result("usm", "shared prefetch, " + name)
+        .with("kernel after host access", cold)
+        .with("prefetch", prefetch)
+        .with("kernel after prefetch", prefetched)
+        .with("kernel, resident", resident)
+        .with("prefetch + kernel speedup",
+              prefetch.median + prefetched.median > 0
+                  ? cold.median / (prefetch.median + prefetched.median)
+                  : 0,
+              "x")
+        .with("on-demand migration",
+              performance::bandwidth_gbs(bytes,
+                                         migration_us > 0 ? migration_us : 0),
+              "GB/s")
+        .with("prefetch migration",
+              performance::bandwidth_gbs(bytes, prefetch), "GB/s")
+        .with("empty kernel", empty)
+        .record();
+
+    // Host and device share memory on CPU devices, so there is nothing to
+    // migrate and prefetch should cost no more than a trivial command
+    if (is_cpu &&
+        prefetch.median > trivial_command_tolerance * empty.median) {
+      WARN("prefetch of " << name << " on a CPU device takes "
+                          << prefetch.median << " us, more than "
+                          << trivial_command_tolerance
+                          << " times an empty kernel (" << empty.median
+                          << " us)");
+    }
+  }
+}
+
+}  // namespace usm_shared_prefetch_perf
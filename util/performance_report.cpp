@@ -0,0 +1,82 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "performance_report.h"
+
+#include <cmath>
+#include <fstream>
+
+namespace sycl_cts {
+namespace util {
+
+static std::string json_escape(const std::string& str) {
+  std::string result;
+  result.reserve(str.size());
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        result += c;
+    }
+  }
+  return result;
+}
+
+void performance_report::write() const {
+  if (output_file.empty()) return;
+
+  std::fstream reportFile(output_file, std::ios::out);
+  reportFile.precision(17);
+
+  reportFile << "[";
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const auto& e = entries[i];
+    reportFile << (i == 0 ? "\n" : ",\n") << "  {\"suite\": \""
+               << json_escape(e.suite) << "\", \"name\": \""
+               << json_escape(e.name) << "\", \"metrics\": {";
+    for (size_t j = 0; j < e.metrics.size(); ++j) {
+      const auto& m = e.metrics[j];
+      reportFile << (j == 0 ? "" : ", ") << "\"" << json_escape(m.name)
+                 << "\": {\"value\": ";
+      // JSON has no representation for infinity and NaN
+      if (std::isfinite(m.value))
+        reportFile << m.value;
+      else
+        reportFile << "null";
+      reportFile << ", \"unit\": \"" << json_escape(m.unit) << "\"}";
+    }
+    reportFile << "}}";
+  }
+  reportFile << "\n]\n";
+}
+
+}  // namespace util
+}  // namespace sycl_cts
@@ -0,0 +1,75 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_UTIL_PERFORMANCE_REPORT_H
+#define __SYCLCTS_UTIL_PERFORMANCE_REPORT_H
+
+#include "singleton.h"
+
+#include <string>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Collects the results of performance test cases during a CTS run, so they can
+ * be written to the file given by the `--perf-report` CLI parameter once all
+ * test cases have finished.
+ */
+class performance_report : public singleton<performance_report> {
+ public:
+  struct metric {
+    std::string name;
+    double value;
+    std::string unit;
+  };
+
+  struct entry {
+    /** Test category or suite the measurement belongs to */
+    std::string suite;
+    /** Name of the measured configuration */
+    std::string name;
+    std::vector<metric> metrics;
+  };
+
+  void set_output_file(std::string file) { output_file = std::move(file); }
+
+  const std::string& get_output_file() const { return output_file; }
+
+  void add(entry e) { entries.push_back(std::move(e)); }
+
+  const std::vector<entry>& get_entries() const { return entries; }
+
+  /**
+   * Writes all recorded entries as a JSON array to the output file.
+   * Does nothing if no output file was set.
+   */
+  void write() const;
+
+ private:
+  std::string output_file;
+  std::vector<entry> entries;
+};
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_UTIL_PERFORMANCE_REPORT_H